@@ -0,0 +1,137 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#if __has_include(<experimental/scope>)
+#include <experimental/scope>
+#endif
+
+#if defined(__cpp_lib_experimental_scope)
+#define SCOPEGUARD_BENCHMARK_EXPERIMENTAL_SCOPE
+#endif
+
+namespace bench
+{
+    using Handle = int;
+
+
+    inline int counter{0};
+
+    inline void exitFunction() noexcept
+    {
+        ++counter;
+        benchmark::DoNotOptimize(counter);
+    }
+
+    inline void work() noexcept
+    {
+        benchmark::DoNotOptimize(counter);
+    }
+
+    inline void deleter(Handle h) noexcept
+    {
+        counter += h;
+        benchmark::DoNotOptimize(counter);
+    }
+
+    inline Handle acquire() noexcept
+    {
+        Handle h{3};
+        benchmark::DoNotOptimize(h);
+        return h;
+    }
+
+
+    struct ExitFunction
+    {
+        void operator()() const noexcept
+        {
+            exitFunction();
+        }
+    };
+
+
+    struct Deleter
+    {
+        void operator()(Handle h) const noexcept
+        {
+            deleter(h);
+        }
+    };
+
+
+    template <bool noexceptMove>
+    struct Resource
+    {
+        explicit Resource(Handle h) noexcept
+            : handle(h)
+        {
+        }
+
+        Resource(const Resource&) = default;
+
+        Resource(Resource&& other) noexcept(noexceptMove)
+            : handle(other.handle)
+        {
+        }
+
+        Resource& operator=(const Resource&) = default;
+
+        Resource& operator=(Resource&& other) noexcept(noexceptMove)
+        {
+            handle = other.handle;
+            return *this;
+        }
+
+        Handle handle;
+    };
+
+
+    template <bool noexceptMove>
+    struct ResourceDeleter
+    {
+        ResourceDeleter() = default;
+
+        ResourceDeleter(const ResourceDeleter&) = default;
+
+        ResourceDeleter(ResourceDeleter&&) noexcept(noexceptMove)
+        {
+        }
+
+        ResourceDeleter& operator=(const ResourceDeleter&) = default;
+
+        ResourceDeleter& operator=(ResourceDeleter&&) noexcept(noexceptMove)
+        {
+            return *this;
+        }
+
+        template <bool b>
+        void operator()(const Resource<b>& r) const noexcept
+        {
+            deleter(r.handle);
+        }
+    };
+
+}
@@ -0,0 +1,170 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "posix.h"
+#include "unique_mapping.h"
+#include "unique_resource.h"
+#include "BenchmarkCommon.h"
+#include <numeric>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+
+namespace
+{
+    class FdPool
+    {
+    public:
+        explicit FdPool(std::size_t count)
+            : source(::open("/dev/null", O_RDONLY)),
+              fds(count)
+        {
+        }
+
+        FdPool(const FdPool&) = delete;
+
+        ~FdPool()
+        {
+            ::close(source);
+        }
+
+        const std::vector<int>& open()
+        {
+            for (auto& fd : fds)
+            {
+                fd = ::dup(source);
+            }
+            return fds;
+        }
+
+        FdPool& operator=(const FdPool&) = delete;
+
+    private:
+        int source;
+        std::vector<int> fds;
+    };
+
+
+    void closeIndividually(benchmark::State& state)
+    {
+        FdPool pool{static_cast<std::size_t>(state.range(0))};
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            std::vector<sr::unique_resource<int, sr::posix::fd_deleter>> resources;
+            const auto& fds = pool.open();
+            resources.reserve(fds.size());
+
+            for (int fd : fds)
+            {
+                resources.emplace_back(fd, sr::posix::fd_deleter{});
+            }
+            state.ResumeTiming();
+        }
+    }
+
+    void closeBatched(benchmark::State& state)
+    {
+        FdPool pool{static_cast<std::size_t>(state.range(0))};
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            sr::cleanup_batch<int, sr::posix::fd_deleter> batch;
+            std::vector<sr::unique_resource<int, sr::batching<sr::posix::fd_deleter>>> resources;
+            const auto& fds = pool.open();
+            resources.reserve(fds.size());
+
+            for (int fd : fds)
+            {
+                resources.emplace_back(fd, sr::batching<sr::posix::fd_deleter>{});
+            }
+            state.ResumeTiming();
+
+            resources.clear();
+        }
+    }
+
+    class DataFile
+    {
+    public:
+        explicit DataFile(std::size_t size)
+            : path("/tmp/PosixBenchmarkXXXXXX"),
+              fd(::mkstemp(path.data()), sr::posix::fd_deleter{})
+        {
+            const std::vector<char> content(size, 'x');
+            benchmark::DoNotOptimize(::write(fd.get(), content.data(), content.size()));
+        }
+
+        DataFile(const DataFile&) = delete;
+
+        ~DataFile()
+        {
+            ::unlink(path.c_str());
+        }
+
+        const sr::posix::unique_fd& get() const
+        {
+            return fd;
+        }
+
+        DataFile& operator=(const DataFile&) = delete;
+
+    private:
+        std::string path;
+        sr::posix::unique_fd fd;
+    };
+
+
+    void readFileCopy(benchmark::State& state)
+    {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        const DataFile file{size};
+
+        for (auto _ : state)
+        {
+            std::vector<char> buffer(size);
+            benchmark::DoNotOptimize(::pread(file.get().get(), buffer.data(), size, 0));
+            benchmark::DoNotOptimize(std::accumulate(buffer.begin(), buffer.end(), 0));
+        }
+    }
+
+    void readFileMapped(benchmark::State& state)
+    {
+        const auto size = static_cast<std::size_t>(state.range(0));
+        const DataFile file{size};
+
+        for (auto _ : state)
+        {
+            auto mapping = sr::posix::unique_mapping::map(file.get(), size);
+            mapping.advise(sr::posix::advice::sequential);
+            const auto view = mapping.view();
+            benchmark::DoNotOptimize(std::accumulate(view.begin(), view.end(), 0));
+        }
+    }
+}
+
+BENCHMARK(closeIndividually)->Arg(16)->Arg(256);
+BENCHMARK(closeBatched)->Arg(16)->Arg(256);
+BENCHMARK(readFileCopy)->Arg(1 << 20);
+BENCHMARK(readFileMapped)->Arg(1 << 20);
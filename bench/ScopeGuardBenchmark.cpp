@@ -0,0 +1,340 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "scope_exit.h"
+#include "scope_fail.h"
+#include "scope_success.h"
+#include "scope_transaction.h"
+#include "defer_stack.h"
+#include "any_scope_exit.h"
+#include "undo_log.h"
+#include "cold.h"
+#include "BenchmarkCommon.h"
+#include <array>
+#include <functional>
+#include <vector>
+
+namespace
+{
+    void rawTryCatch(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            try
+            {
+                bench::work();
+            }
+            catch (...)
+            {
+                bench::exitFunction();
+                throw;
+            }
+            bench::exitFunction();
+        }
+    }
+
+    void rawRelease(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            bool execute{true};
+            benchmark::DoNotOptimize(execute);
+            bench::work();
+            execute = false;
+
+            if (execute == true)
+            {
+                bench::exitFunction();
+            }
+        }
+    }
+
+    template <template <class> class Guard>
+    void guardConstruction(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            Guard<bench::ExitFunction> guard{bench::ExitFunction{}};
+            bench::work();
+        }
+    }
+
+    template <template <class> class Guard>
+    void guardConstructionFromLvalue(benchmark::State& state)
+    {
+        const bench::ExitFunction exitFunction{};
+
+        for (auto _ : state)
+        {
+            Guard<bench::ExitFunction> guard{exitFunction};
+            bench::work();
+        }
+    }
+
+    template <template <class> class Guard>
+    void guardRelease(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            Guard<bench::ExitFunction> guard{bench::ExitFunction{}};
+            bench::work();
+            guard.release();
+        }
+    }
+
+    template <template <class> class Guard>
+    void guardMoveConstruction(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            Guard<bench::ExitFunction> movedFrom{bench::ExitFunction{}};
+            Guard<bench::ExitFunction> guard{std::move(movedFrom)};
+            bench::work();
+        }
+    }
+
+    template <template <class...> class Guard>
+    void separateGuards(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            Guard<bench::ExitFunction> guard1{bench::ExitFunction{}};
+            Guard<bench::ExitFunction> guard2{bench::ExitFunction{}};
+            Guard<bench::ExitFunction> guard3{bench::ExitFunction{}};
+            bench::work();
+        }
+    }
+
+    template <template <class...> class Guard>
+    void fusedGuard(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            Guard<bench::ExitFunction, bench::ExitFunction, bench::ExitFunction> guard{bench::ExitFunction{}, bench::ExitFunction{}, bench::ExitFunction{}};
+            bench::work();
+        }
+    }
+
+    void functionGuard(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            const auto exitFunction = [handles = std::array<bench::Handle, 6>{bench::acquire()}]
+            {
+                bench::deleter(handles[0]);
+            };
+            sr::scope_exit<std::function<void()>> guard{exitFunction};
+            bench::work();
+        }
+    }
+
+    void anyScopeExit(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            const auto exitFunction = [handles = std::array<bench::Handle, 6>{bench::acquire()}]
+            {
+                bench::deleter(handles[0]);
+            };
+            sr::any_scope_exit<> guard{exitFunction};
+            bench::work();
+        }
+    }
+
+    void functionVector(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            std::vector<std::function<void()>> exitFunctions;
+
+            for (auto i = state.range(0); i > 0; --i)
+            {
+                exitFunctions.emplace_back([i]
+                                           { bench::deleter(static_cast<bench::Handle>(i)); });
+            }
+            bench::work();
+
+            for (auto itr = exitFunctions.rbegin(); itr != exitFunctions.rend(); ++itr)
+            {
+                (*itr)();
+            }
+        }
+    }
+
+    void deferStack(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            sr::defer_stack<256> exitFunctions;
+
+            for (auto i = state.range(0); i > 0; --i)
+            {
+                exitFunctions.push([i]
+                                   { bench::deleter(static_cast<bench::Handle>(i)); });
+            }
+            bench::work();
+        }
+    }
+
+    void undoLog(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            sr::undo_log<128> log;
+            log.push(bench::ExitFunction{});
+            log.push(bench::ExitFunction{});
+            log.push(bench::ExitFunction{});
+            log.push(bench::ExitFunction{});
+            bench::work();
+            log.commit();
+        }
+    }
+
+    void separateFailSuccessGuards(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            sr::scope_fail<bench::ExitFunction> rollback1{bench::ExitFunction{}};
+            sr::scope_success<bench::ExitFunction> commit1{bench::ExitFunction{}};
+            sr::scope_fail<bench::ExitFunction> rollback2{bench::ExitFunction{}};
+            sr::scope_success<bench::ExitFunction> commit2{bench::ExitFunction{}};
+            bench::work();
+        }
+    }
+
+    void scopeTransaction(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            sr::scope_transaction tx{sr::on_fail(bench::ExitFunction{}), sr::on_success(bench::ExitFunction{}),
+                                     sr::on_fail(bench::ExitFunction{}), sr::on_success(bench::ExitFunction{})};
+            bench::work();
+        }
+    }
+
+
+    struct LargeExitFunction
+    {
+        explicit LargeExitFunction(char fill) noexcept
+        {
+            buffer.fill(fill);
+        }
+
+        void operator()() const noexcept
+        {
+            benchmark::DoNotOptimize(buffer.data());
+        }
+
+        std::array<char, 1024> buffer;
+    };
+
+    void largeGuardFromLvalue(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            const LargeExitFunction exitFunction{'x'};
+            sr::scope_exit guard{exitFunction};
+            bench::work();
+        }
+    }
+
+    void largeGuardInPlace(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            sr::scope_exit guard{std::in_place_type<LargeExitFunction>, 'x'};
+            bench::work();
+        }
+    }
+
+    struct RollbackFunction
+    {
+        void operator()() const noexcept
+        {
+            for (bench::Handle h = 0; h < 8; ++h)
+            {
+                bench::deleter(h);
+            }
+        }
+    };
+
+    template <class EF>
+    void failGuard(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            sr::scope_fail guard{EF{RollbackFunction{}}};
+            bench::work();
+        }
+    }
+}
+
+
+BENCHMARK(rawTryCatch);
+BENCHMARK(rawRelease);
+
+BENCHMARK_TEMPLATE(guardConstruction, sr::scope_exit);
+BENCHMARK_TEMPLATE(guardConstruction, sr::scope_fail);
+BENCHMARK_TEMPLATE(guardConstruction, sr::scope_success);
+
+BENCHMARK_TEMPLATE(guardConstructionFromLvalue, sr::scope_exit);
+BENCHMARK_TEMPLATE(guardConstructionFromLvalue, sr::scope_fail);
+BENCHMARK_TEMPLATE(guardConstructionFromLvalue, sr::scope_success);
+
+BENCHMARK_TEMPLATE(guardRelease, sr::scope_exit);
+BENCHMARK_TEMPLATE(guardRelease, sr::scope_fail);
+BENCHMARK_TEMPLATE(guardRelease, sr::scope_success);
+
+BENCHMARK_TEMPLATE(guardMoveConstruction, sr::scope_exit);
+BENCHMARK_TEMPLATE(guardMoveConstruction, sr::scope_fail);
+BENCHMARK_TEMPLATE(guardMoveConstruction, sr::scope_success);
+
+BENCHMARK_TEMPLATE(separateGuards, sr::scope_exit);
+BENCHMARK_TEMPLATE(fusedGuard, sr::scope_exit_all);
+BENCHMARK_TEMPLATE(separateGuards, sr::scope_fail);
+BENCHMARK_TEMPLATE(fusedGuard, sr::scope_fail_all);
+
+BENCHMARK(functionGuard);
+BENCHMARK(anyScopeExit);
+
+BENCHMARK(functionVector)->Arg(4)->Arg(64);
+BENCHMARK(deferStack)->Arg(4)->Arg(64);
+
+BENCHMARK(undoLog);
+BENCHMARK(separateFailSuccessGuards);
+BENCHMARK(scopeTransaction);
+
+BENCHMARK(largeGuardFromLvalue);
+BENCHMARK(largeGuardInPlace);
+
+BENCHMARK_TEMPLATE(failGuard, RollbackFunction);
+BENCHMARK_TEMPLATE(failGuard, sr::cold<RollbackFunction>);
+
+#ifdef SCOPEGUARD_BENCHMARK_EXPERIMENTAL_SCOPE
+BENCHMARK_TEMPLATE(guardConstruction, std::experimental::scope_exit);
+BENCHMARK_TEMPLATE(guardConstruction, std::experimental::scope_fail);
+BENCHMARK_TEMPLATE(guardConstruction, std::experimental::scope_success);
+
+BENCHMARK_TEMPLATE(guardRelease, std::experimental::scope_exit);
+BENCHMARK_TEMPLATE(guardRelease, std::experimental::scope_fail);
+BENCHMARK_TEMPLATE(guardRelease, std::experimental::scope_success);
+#endif
@@ -0,0 +1,522 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "unique_resource.h"
+#include "unique_resource_array.h"
+#include "reclaimer.h"
+#include "epoch_domain.h"
+#include "shared_resource.h"
+#include "atomic_unique_resource.h"
+#include "resource_pool.h"
+#include "lazy_unique_resource.h"
+#include "timing.h"
+#include "BenchmarkCommon.h"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    template <bool noexceptResource, bool noexceptDeleter>
+    using MoveAssignResource = sr::unique_resource<bench::Resource<noexceptResource>, bench::ResourceDeleter<noexceptDeleter>>;
+
+
+    void rawTryCatch(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            const auto handle = bench::acquire();
+
+            try
+            {
+                bench::work();
+            }
+            catch (...)
+            {
+                bench::deleter(handle);
+                throw;
+            }
+            bench::deleter(handle);
+        }
+    }
+
+    template <class UniqueResource>
+    void construction(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            UniqueResource resource{bench::acquire(), bench::Deleter{}};
+            bench::work();
+        }
+    }
+
+    template <class UniqueResource>
+    void constructionFunctionPointer(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            UniqueResource resource{bench::acquire(), &bench::deleter};
+            bench::work();
+        }
+    }
+
+    template <class UniqueResource>
+    void release(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            UniqueResource resource{bench::acquire(), bench::Deleter{}};
+            bench::work();
+            resource.release();
+        }
+    }
+
+    template <class UniqueResource>
+    void moveConstruction(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            UniqueResource movedFrom{bench::acquire(), bench::Deleter{}};
+            UniqueResource resource{std::move(movedFrom)};
+            bench::work();
+        }
+    }
+
+    template <class UniqueResource>
+    void moveAssignment(benchmark::State& state)
+    {
+        using Resource = std::decay_t<decltype(std::declval<UniqueResource>().get())>;
+        using Deleter = std::decay_t<decltype(std::declval<UniqueResource>().get_deleter())>;
+
+        for (auto _ : state)
+        {
+            UniqueResource movedFrom{Resource{bench::acquire()}, Deleter{}};
+            UniqueResource resource{Resource{bench::acquire()}, Deleter{}};
+            resource = std::move(movedFrom);
+            bench::work();
+        }
+    }
+
+    template <class UniqueResource>
+    void resetWithValue(benchmark::State& state)
+    {
+        UniqueResource resource{bench::acquire(), bench::Deleter{}};
+
+        for (auto _ : state)
+        {
+            resource.reset(bench::acquire());
+            bench::work();
+        }
+    }
+
+    void makeUniqueResourceChecked(benchmark::State& state)
+    {
+        const auto invalid = static_cast<bench::Handle>(state.range(0));
+
+        for (auto _ : state)
+        {
+            auto resource = sr::make_unique_resource_checked(bench::acquire(), invalid, bench::Deleter{});
+            bench::work();
+        }
+    }
+
+    struct PaddedEntry
+    {
+        bench::Handle handle;
+        bool owned;
+        bench::Deleter deleter;
+    };
+
+    void scanPaddedEntries(benchmark::State& state)
+    {
+        std::vector<PaddedEntry> entries(static_cast<std::size_t>(state.range(0)));
+
+        for (std::size_t i = 0; i < entries.size(); i += 64)
+        {
+            entries[i] = PaddedEntry{static_cast<bench::Handle>(i), true, {}};
+        }
+
+        for (auto _ : state)
+        {
+            bench::Handle sum{0};
+
+            for (const auto& entry : entries)
+            {
+                if (entry.owned == true)
+                {
+                    sum += entry.handle;
+                }
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+
+    void scanUniqueResourceArray(benchmark::State& state)
+    {
+        struct NoopDeleter
+        {
+            void operator()(bench::Handle) const noexcept
+            {
+            }
+        };
+
+        sr::unique_resource_array<bench::Handle, NoopDeleter> array;
+        array.reserve(static_cast<std::size_t>(state.range(0)));
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(state.range(0)); ++i)
+        {
+            array.emplace(static_cast<bench::Handle>(i));
+        }
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(state.range(0)); ++i)
+        {
+            if ((i % 64) != 0)
+            {
+                array.release(i);
+            }
+        }
+
+        for (auto _ : state)
+        {
+            bench::Handle sum{0};
+
+            for (const auto handle : array.live_handles())
+            {
+                sum += handle;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+
+    struct SlowDeleter
+    {
+        void operator()(bench::Handle h) const noexcept
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                bench::deleter(h);
+            }
+        }
+    };
+
+    void slowDeleterInline(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            sr::unique_resource<bench::Handle, SlowDeleter> r{bench::acquire(), SlowDeleter{}};
+            bench::work();
+        }
+    }
+
+    void slowDeleterDeferred(benchmark::State& state)
+    {
+        sr::reclaimer<bench::Handle, SlowDeleter> reclaimer{static_cast<std::size_t>(state.range(0)), sr::overflow_policy::delete_inline};
+
+        for (auto _ : state)
+        {
+            sr::unique_resource r{bench::acquire(), reclaimer.get_deleter()};
+            bench::work();
+        }
+
+        reclaimer.drain();
+        state.counters["deleted_inline"] = static_cast<double>(reclaimer.stats().deleted_inline);
+    }
+
+    bench::Handle slowAcquire() noexcept
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            benchmark::DoNotOptimize(bench::acquire());
+        }
+        return bench::acquire();
+    }
+
+    void openCloseUnpooled(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            sr::unique_resource r{slowAcquire(), SlowDeleter{}};
+            bench::work();
+        }
+    }
+
+    void openClosePooled(benchmark::State& state)
+    {
+        static sr::resource_pool<bench::Handle, SlowDeleter> pool;
+
+        for (auto _ : state)
+        {
+            auto r = pool.acquire(slowAcquire);
+            bench::work();
+        }
+
+        if (state.thread_index() == 0)
+        {
+            const auto stats = pool.stats();
+            state.counters["hits"] = static_cast<double>(stats.hits);
+            state.counters["misses"] = static_cast<double>(stats.misses);
+        }
+    }
+
+    void startupEager(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            std::vector<sr::unique_resource<bench::Handle, SlowDeleter>> resources;
+            resources.reserve(static_cast<std::size_t>(state.range(0)));
+
+            for (std::int64_t i = 0; i < state.range(0); ++i)
+            {
+                resources.emplace_back(slowAcquire(), SlowDeleter{});
+            }
+            benchmark::DoNotOptimize(resources.data());
+        }
+    }
+
+    void startupLazy(benchmark::State& state)
+    {
+        using LazyResource = sr::lazy_unique_resource<bench::Handle, SlowDeleter, bench::Handle (*)() noexcept>;
+
+        for (auto _ : state)
+        {
+            std::deque<LazyResource> resources;
+
+            for (std::int64_t i = 0; i < state.range(0); ++i)
+            {
+                resources.emplace_back(&slowAcquire, SlowDeleter{});
+            }
+            benchmark::DoNotOptimize(resources);
+        }
+    }
+
+    void getLazyAcquired(benchmark::State& state)
+    {
+        const sr::lazy_unique_resource<bench::Handle, bench::Deleter, bench::Handle (*)() noexcept> resource{&bench::acquire, bench::Deleter{}};
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(resource.get());
+        }
+    }
+
+    const auto sharedValue = std::make_shared<bench::Handle>(3);
+
+    void readSharedPtr(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            const auto value = std::atomic_load(&sharedValue);
+            benchmark::DoNotOptimize(*value);
+        }
+    }
+
+    sr::epoch_domain domain;
+    bench::Handle epochValue{3};
+    std::atomic<bench::Handle*> epochPointer{&epochValue};
+
+    void readEpochPinned(benchmark::State& state)
+    {
+        auto reader = domain.register_reader();
+
+        for (auto _ : state)
+        {
+            [[maybe_unused]] const auto guard = reader.pin();
+            benchmark::DoNotOptimize(*epochPointer.load(std::memory_order_acquire));
+        }
+    }
+
+    struct SharedPtrFactory
+    {
+        static std::shared_ptr<bench::Handle> make()
+        {
+            return std::shared_ptr<bench::Handle>{new bench::Handle{bench::acquire()}, [](bench::Handle* h) noexcept
+                                                  {
+                                                      bench::deleter(*h);
+                                                      delete h;
+                                                  }};
+        }
+    };
+
+    template <class RefCount>
+    struct SharedResourceFactory
+    {
+        static sr::shared_resource<bench::Handle, bench::Deleter, RefCount> make()
+        {
+            return {bench::acquire(), bench::Deleter{}};
+        }
+    };
+
+    template <class Factory>
+    void sharedCopy(benchmark::State& state)
+    {
+        const auto shared = Factory::make();
+
+        for (auto _ : state)
+        {
+            auto copy = shared;
+            benchmark::DoNotOptimize(copy);
+        }
+    }
+
+    template <class Factory>
+    void sharedCreateDestroy(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            auto shared = Factory::make();
+            benchmark::DoNotOptimize(shared);
+        }
+    }
+
+    template <class Factory>
+    void sharedHandoff(benchmark::State& state)
+    {
+        static decltype(Factory::make()) shared;
+
+        if (state.thread_index() == 0)
+        {
+            shared = Factory::make();
+        }
+
+        for (auto _ : state)
+        {
+            auto copy = shared;
+            benchmark::DoNotOptimize(copy);
+        }
+
+        if (state.thread_index() == 0)
+        {
+            shared = {};
+        }
+    }
+
+    struct MutexSlot
+    {
+        void put(sr::unique_resource<bench::Handle, bench::Deleter, sr::sentinel<-1>>&& r)
+        {
+            const std::lock_guard lock{mutex};
+            slot = std::move(r);
+        }
+
+        sr::unique_resource<bench::Handle, bench::Deleter, sr::sentinel<-1>> take()
+        {
+            const std::lock_guard lock{mutex};
+            return std::move(slot);
+        }
+
+        std::mutex mutex;
+        sr::unique_resource<bench::Handle, bench::Deleter, sr::sentinel<-1>> slot{-1, bench::Deleter{}};
+    };
+
+    struct AtomicSlot
+    {
+        void put(sr::unique_resource<bench::Handle, bench::Deleter, sr::sentinel<-1>>&& r)
+        {
+            slot.exchange(std::move(r));
+        }
+
+        sr::unique_resource<bench::Handle, bench::Deleter, sr::sentinel<-1>> take()
+        {
+            return slot.take();
+        }
+
+        sr::atomic_unique_resource<bench::Handle, bench::Deleter, -1> slot;
+    };
+
+    template <class Slot>
+    void slotHandoff(benchmark::State& state)
+    {
+        static Slot slot;
+
+        for (auto _ : state)
+        {
+            if (state.thread_index() == 0)
+            {
+                slot.put(sr::make_unique_resource_checked<-1>(bench::acquire(), bench::Deleter{}));
+            }
+            else
+            {
+                auto r = slot.take();
+                benchmark::DoNotOptimize(r);
+            }
+        }
+    }
+
+#ifdef SCOPEGUARD_BENCHMARK_EXPERIMENTAL_SCOPE
+    void makeUniqueResourceCheckedExperimental(benchmark::State& state)
+    {
+        const auto invalid = static_cast<bench::Handle>(state.range(0));
+
+        for (auto _ : state)
+        {
+            auto resource = std::experimental::make_unique_resource_checked(bench::acquire(), invalid, bench::Deleter{});
+            bench::work();
+        }
+    }
+#endif
+}
+
+
+BENCHMARK(rawTryCatch);
+
+BENCHMARK_TEMPLATE(construction, sr::unique_resource<bench::Handle, bench::Deleter>);
+BENCHMARK_TEMPLATE(construction, sr::timed_unique_resource<bench::Handle, bench::Deleter>);
+BENCHMARK_TEMPLATE(constructionFunctionPointer, sr::unique_resource<bench::Handle, void (*)(bench::Handle) noexcept>);
+BENCHMARK_TEMPLATE(release, sr::unique_resource<bench::Handle, bench::Deleter>);
+BENCHMARK_TEMPLATE(moveConstruction, sr::unique_resource<bench::Handle, bench::Deleter>);
+BENCHMARK_TEMPLATE(moveAssignment, MoveAssignResource<true, true>);
+BENCHMARK_TEMPLATE(moveAssignment, MoveAssignResource<true, false>);
+BENCHMARK_TEMPLATE(moveAssignment, MoveAssignResource<false, true>);
+BENCHMARK_TEMPLATE(moveAssignment, MoveAssignResource<false, false>);
+BENCHMARK_TEMPLATE(resetWithValue, sr::unique_resource<bench::Handle, bench::Deleter>);
+BENCHMARK(makeUniqueResourceChecked)->Arg(-1)->Arg(3);
+BENCHMARK(scanPaddedEntries)->Arg(1 << 20);
+BENCHMARK(scanUniqueResourceArray)->Arg(1 << 20);
+BENCHMARK(slowDeleterInline);
+BENCHMARK(slowDeleterDeferred)->Arg(1 << 16);
+BENCHMARK(openCloseUnpooled)->Threads(1)->Threads(4);
+BENCHMARK(openClosePooled)->Threads(1)->Threads(4);
+BENCHMARK(startupEager)->Arg(64);
+BENCHMARK(startupLazy)->Arg(64);
+BENCHMARK(getLazyAcquired);
+BENCHMARK(readSharedPtr)->Threads(1)->Threads(4);
+BENCHMARK(readEpochPinned)->Threads(1)->Threads(4);
+BENCHMARK_TEMPLATE(sharedCopy, SharedPtrFactory);
+BENCHMARK_TEMPLATE(sharedCopy, SharedResourceFactory<sr::atomic_refcount>);
+BENCHMARK_TEMPLATE(sharedCopy, SharedResourceFactory<sr::local_refcount>);
+BENCHMARK_TEMPLATE(sharedCreateDestroy, SharedPtrFactory);
+BENCHMARK_TEMPLATE(sharedCreateDestroy, SharedResourceFactory<sr::atomic_refcount>);
+BENCHMARK_TEMPLATE(sharedHandoff, SharedPtrFactory)->Threads(2);
+BENCHMARK_TEMPLATE(sharedHandoff, SharedResourceFactory<sr::atomic_refcount>)->Threads(2);
+BENCHMARK_TEMPLATE(slotHandoff, MutexSlot)->Threads(2);
+BENCHMARK_TEMPLATE(slotHandoff, AtomicSlot)->Threads(2);
+
+#ifdef SCOPEGUARD_BENCHMARK_EXPERIMENTAL_SCOPE
+BENCHMARK_TEMPLATE(construction, std::experimental::unique_resource<bench::Handle, bench::Deleter>);
+BENCHMARK_TEMPLATE(release, std::experimental::unique_resource<bench::Handle, bench::Deleter>);
+BENCHMARK_TEMPLATE(moveConstruction, std::experimental::unique_resource<bench::Handle, bench::Deleter>);
+BENCHMARK_TEMPLATE(resetWithValue, std::experimental::unique_resource<bench::Handle, bench::Deleter>);
+BENCHMARK(makeUniqueResourceCheckedExperimental)->Arg(-1)->Arg(3);
+#endif
@@ -28,7 +28,7 @@ class ScopeguardConan(ConanFile):
     )
     settings = "os", "arch", "compiler", "build_type"
     exports = ["LICENSE"]
-    exports_sources = ("CMakeLists.txt", "include/*", "test/*", "cmake/*")
+    exports_sources = ("CMakeLists.txt", "include/*", "test/*", "bench/*", "cmake/*")
     package_type = "header-library"
     options = {"unittest": [True, False], "enable_compat_header": [True, False]}
     default_options = {"unittest": False, "enable_compat_header": False}
@@ -0,0 +1,118 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "detail/any_callable.h"
+#include "detail/scope_guard_base.h"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace sr
+{
+    template <std::size_t Size = detail::default_buffer_size>
+    class any_scope_exit
+    {
+        using ExitFunction = detail::any_callable<void(), Size>;
+
+    public:
+        any_scope_exit() noexcept
+            : execute_on_destruction(false)
+        {
+        }
+
+        template <class EFP,
+                  std::enable_if_t<!std::is_same_v<std::decay_t<EFP>, any_scope_exit>, int> = 0,
+                  std::enable_if_t<std::is_constructible_v<ExitFunction, EFP>, int> = 0>
+        explicit any_scope_exit(EFP&& exitFunction) noexcept(std::is_nothrow_constructible_v<ExitFunction, EFP>)
+            : exit_function(make_exit_function(std::forward<EFP>(exitFunction))),
+              execute_on_destruction(true)
+        {
+        }
+
+        any_scope_exit(any_scope_exit&& other) noexcept
+            : exit_function(std::move(other.exit_function)),
+              execute_on_destruction(other.execute_on_destruction)
+        {
+            other.release();
+        }
+
+        any_scope_exit(const any_scope_exit&) = delete;
+
+        ~any_scope_exit()
+        {
+            execute();
+        }
+
+
+        void release() noexcept
+        {
+            execute_on_destruction = false;
+        }
+
+
+        any_scope_exit& operator=(any_scope_exit&& other) noexcept
+        {
+            if (this != &other)
+            {
+                execute();
+                exit_function = std::move(other.exit_function);
+                execute_on_destruction = other.execute_on_destruction;
+                other.release();
+            }
+            return *this;
+        }
+
+        any_scope_exit& operator=(const any_scope_exit&) = delete;
+
+
+    private:
+        template <class EFP>
+        static ExitFunction make_exit_function(EFP&& exitFunction) noexcept(std::is_nothrow_constructible_v<ExitFunction, EFP>)
+        {
+            auto onFailure = [&exitFunction]
+            {
+                exitFunction();
+            };
+            detail::scope_guard_base<decltype(onFailure), detail::construction_strategy> guard{std::move(onFailure)};
+
+            ExitFunction erased{std::forward<EFP>(exitFunction)};
+            guard.release();
+            return erased;
+        }
+
+        void execute() noexcept
+        {
+            if (execute_on_destruction == true)
+            {
+                execute_on_destruction = false;
+                exit_function();
+            }
+        }
+
+
+        ExitFunction exit_function;
+        bool execute_on_destruction;
+    };
+
+}
@@ -0,0 +1,156 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "unique_resource.h"
+#include "detail/wrapper.h"
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+namespace sr
+{
+    namespace detail
+    {
+        template <class R, auto Invalid>
+        constexpr auto atomic_invalid_value() noexcept
+        {
+            if constexpr (std::is_null_pointer_v<decltype(Invalid)> == true)
+            {
+                return R{};
+            }
+            else
+            {
+                return Invalid;
+            }
+        }
+    }
+
+
+    template <class R, class D, auto Invalid = nullptr>
+    class atomic_unique_resource : private detail::Wrapper<D, detail::DeleterTag>
+    {
+        using DeleterWrapper = detail::Wrapper<D, detail::DeleterTag>;
+
+        static constexpr auto invalid = detail::atomic_invalid_value<R, Invalid>();
+
+        static_assert(std::atomic<R>::is_always_lock_free, "Resource type has to be lock-free");
+        static_assert(std::is_nothrow_copy_constructible_v<D>, "Deleter has to be nothrow copy constructible");
+        static_assert(std::is_pointer_v<R> || (std::is_null_pointer_v<decltype(Invalid)> == false), "Invalid value has to be specified for non-pointer resources");
+
+    public:
+        using unique_resource_type = unique_resource<R, D, sentinel<Invalid>>;
+
+
+        atomic_unique_resource() noexcept(std::is_nothrow_default_constructible_v<D>)
+            : DeleterWrapper(D{}),
+              handle(invalid)
+        {
+        }
+
+        template <class DD, std::enable_if_t<std::is_constructible_v<D, DD>, int> = 0>
+        explicit atomic_unique_resource(DD&& d) noexcept(std::is_nothrow_constructible_v<D, DD>)
+            : DeleterWrapper(std::forward<DD>(d)),
+              handle(invalid)
+        {
+        }
+
+        explicit atomic_unique_resource(unique_resource_type&& other) noexcept
+            : DeleterWrapper(other.get_deleter()),
+              handle(other.get())
+        {
+            other.release();
+        }
+
+        atomic_unique_resource(const atomic_unique_resource&) = delete;
+
+        ~atomic_unique_resource()
+        {
+            reset();
+        }
+
+
+        unique_resource_type exchange(unique_resource_type&& desired) noexcept
+        {
+            const R previous = handle.exchange(desired.get(), std::memory_order_acq_rel);
+            desired.release();
+            return unique_resource_type{previous, get_deleter()};
+        }
+
+        bool compare_exchange(R& expected, unique_resource_type& desired) noexcept
+        {
+            if (handle.compare_exchange_strong(expected, desired.get(), std::memory_order_acq_rel, std::memory_order_acquire) == true)
+            {
+                desired.release();
+                desired.reset(expected);
+                return true;
+            }
+            return false;
+        }
+
+        unique_resource_type take() noexcept
+        {
+            return unique_resource_type{handle.exchange(invalid, std::memory_order_acq_rel), get_deleter()};
+        }
+
+        void reset() noexcept
+        {
+            [[maybe_unused]] const auto previous = take();
+        }
+
+        void reset(R r) noexcept
+        {
+            [[maybe_unused]] const auto previous = exchange(unique_resource_type{r, get_deleter()});
+        }
+
+        R release() noexcept
+        {
+            return handle.exchange(invalid, std::memory_order_acq_rel);
+        }
+
+        R load(std::memory_order order = std::memory_order_acquire) const noexcept
+        {
+            return handle.load(order);
+        }
+
+        const D& get_deleter() const noexcept
+        {
+            return static_cast<const DeleterWrapper&>(*this).get();
+        }
+
+
+        atomic_unique_resource& operator=(const atomic_unique_resource&) = delete;
+
+
+        static constexpr bool is_always_lock_free = std::atomic<R>::is_always_lock_free;
+
+
+    private:
+        std::atomic<R> handle;
+    };
+
+
+    template <class R, class D, auto Invalid>
+    atomic_unique_resource(unique_resource<R, D, sentinel<Invalid>>&&) -> atomic_unique_resource<R, D, Invalid>;
+
+}
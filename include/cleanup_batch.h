@@ -0,0 +1,209 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "detail/wrapper.h"
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sr
+{
+    template <class R>
+    class resource_span
+    {
+    public:
+        constexpr resource_span(const R* pointer, std::size_t length) noexcept
+            : first(pointer),
+              count(length)
+        {
+        }
+
+
+        constexpr const R* begin() const noexcept
+        {
+            return first;
+        }
+
+        constexpr const R* end() const noexcept
+        {
+            return first + count;
+        }
+
+        constexpr const R* data() const noexcept
+        {
+            return first;
+        }
+
+        constexpr std::size_t size() const noexcept
+        {
+            return count;
+        }
+
+        constexpr bool empty() const noexcept
+        {
+            return count == 0;
+        }
+
+        constexpr const R& operator[](std::size_t index) const noexcept
+        {
+            return first[index];
+        }
+
+
+    private:
+        const R* first;
+        std::size_t count;
+    };
+
+
+    template <class D, class R>
+    struct is_batch_deleter : public std::is_invocable<const D&, resource_span<R>>
+    {
+    };
+
+    template <class D, class R>
+    inline constexpr bool is_batch_deleter_v = is_batch_deleter<D, R>::value;
+
+
+    template <class R, class D>
+    class cleanup_batch
+    {
+        static constexpr bool is_nothrow_flush = is_batch_deleter_v<D, R> ? std::is_nothrow_invocable_v<D&, resource_span<R>> : std::is_nothrow_invocable_v<D&, const R&>;
+
+    public:
+        static constexpr std::size_t default_capacity = 1024;
+
+
+        explicit cleanup_batch(std::size_t capacity = default_capacity, D d = D{})
+            : deleter(std::move(d)),
+              previous(current_batch)
+        {
+            handles.reserve(capacity > 0 ? capacity : 1);
+            current_batch = this;
+        }
+
+        cleanup_batch(const cleanup_batch&) = delete;
+        cleanup_batch(cleanup_batch&&) = delete;
+
+        ~cleanup_batch()
+        {
+            assert((current_batch == this) && "cleanup_batch must be destroyed in reverse order of construction");
+            flush();
+            current_batch = previous;
+        }
+
+
+        void push(const R& r) noexcept(is_nothrow_flush && std::is_nothrow_copy_constructible_v<R>)
+        {
+            if (handles.size() == handles.capacity())
+            {
+                flush();
+            }
+            handles.push_back(r);
+        }
+
+        void flush() noexcept(is_nothrow_flush)
+        {
+            if (handles.empty() == false)
+            {
+                if constexpr (is_batch_deleter_v<D, R> == true)
+                {
+                    deleter(resource_span<R>{handles.data(), handles.size()});
+                }
+                else
+                {
+                    for (const auto& r : handles)
+                    {
+                        deleter(r);
+                    }
+                }
+                handles.clear();
+            }
+        }
+
+        std::size_t size() const noexcept
+        {
+            return handles.size();
+        }
+
+        static cleanup_batch* current() noexcept
+        {
+            return current_batch;
+        }
+
+
+        cleanup_batch& operator=(const cleanup_batch&) = delete;
+        cleanup_batch& operator=(cleanup_batch&&) = delete;
+
+
+    private:
+        static inline thread_local cleanup_batch* current_batch{nullptr};
+
+        std::vector<R> handles;
+        D deleter;
+        cleanup_batch* previous;
+    };
+
+
+    template <class D>
+    class batching : private detail::Wrapper<D>
+    {
+        static_assert(std::is_empty_v<D>, "Batched handles are deleted by the batch's deleter, so D must be stateless");
+
+    public:
+        batching()
+            : detail::Wrapper<D>(D{})
+        {
+        }
+
+        template <class DD, std::enable_if_t<!std::is_same_v<std::decay_t<DD>, batching> && std::is_constructible_v<D, DD>, int> = 0>
+        explicit batching(DD&& d) noexcept(std::is_nothrow_constructible_v<D, DD>)
+            : detail::Wrapper<D>(std::forward<DD>(d))
+        {
+        }
+
+
+        template <class R>
+        void operator()(const R& r) const
+        {
+            if (auto* batch = cleanup_batch<R, D>::current(); batch != nullptr)
+            {
+                batch->push(r);
+            }
+            else
+            {
+                this->get()(r);
+            }
+        }
+
+        template <class R, std::enable_if_t<is_batch_deleter_v<D, R>, int> = 0>
+        void operator()(resource_span<R> resources) const
+        {
+            this->get()(resources);
+        }
+    };
+
+}
@@ -0,0 +1,71 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "detail/config.h"
+#include "detail/wrapper.h"
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace sr
+{
+    namespace detail
+    {
+        template <class F, class... Args>
+        SCOPEGUARD_COLD void invoke_cold(F& f, Args&&... args) noexcept(std::is_nothrow_invocable_v<F&, Args...>)
+        {
+            std::invoke(f, std::forward<Args>(args)...);
+        }
+    }
+
+
+    template <class F>
+    class cold : private detail::Wrapper<F>
+    {
+    public:
+        template <class FF, std::enable_if_t<(std::is_constructible_v<F, FF> && !std::is_same_v<std::decay_t<FF>, cold>), int> = 0>
+        explicit cold(FF&& f) noexcept(std::is_nothrow_constructible_v<F, FF>)
+            : detail::Wrapper<F>(std::forward<FF>(f))
+        {
+        }
+
+
+        template <class... Args>
+        void operator()(Args&&... args) noexcept(std::is_nothrow_invocable_v<F&, Args...>)
+        {
+            detail::invoke_cold(this->get(), std::forward<Args>(args)...);
+        }
+
+        template <class... Args>
+        void operator()(Args&&... args) const noexcept(std::is_nothrow_invocable_v<const F&, Args...>)
+        {
+            detail::invoke_cold(this->get(), std::forward<Args>(args)...);
+        }
+    };
+
+
+    template <class F>
+    cold(F) -> cold<F>;
+
+}
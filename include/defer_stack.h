@@ -0,0 +1,86 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "detail/callable_stack.h"
+#include "detail/scope_guard_base.h"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace sr
+{
+    template <std::size_t N = 256>
+    class defer_stack
+    {
+    public:
+        defer_stack() noexcept = default;
+
+        defer_stack(const defer_stack&) = delete;
+
+        ~defer_stack()
+        {
+            exitFunctions.run();
+        }
+
+
+        template <class EFP,
+                  std::enable_if_t<std::is_constructible_v<std::decay_t<EFP>, EFP>, int> = 0,
+                  std::enable_if_t<std::is_invocable_v<std::decay_t<EFP>&>, int> = 0,
+                  std::enable_if_t<std::is_lvalue_reference_v<EFP> || std::is_nothrow_constructible_v<std::decay_t<EFP>, EFP>, int> = 0>
+        void push(EFP&& exitFunction)
+        {
+            auto onFailure = [&exitFunction]
+            {
+                exitFunction();
+            };
+            detail::scope_guard_base<decltype(onFailure), detail::construction_strategy> guard{std::move(onFailure)};
+
+            exitFunctions.template push<std::decay_t<EFP>>(std::forward<EFP>(exitFunction));
+            guard.release();
+        }
+
+        void release() noexcept
+        {
+            exitFunctions.clear();
+        }
+
+        std::size_t size() const noexcept
+        {
+            return exitFunctions.size();
+        }
+
+        bool empty() const noexcept
+        {
+            return exitFunctions.empty();
+        }
+
+
+        defer_stack& operator=(const defer_stack&) = delete;
+
+
+    private:
+        detail::callable_stack<N> exitFunctions;
+    };
+
+}
@@ -0,0 +1,188 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sr::detail
+{
+    inline constexpr std::size_t default_buffer_size = 4 * sizeof(void*);
+
+
+    template <class Signature, std::size_t Size>
+    class any_callable;
+
+    template <class... Args, std::size_t Size>
+    class any_callable<void(Args...), Size>
+    {
+        static constexpr std::size_t bufferSize = (Size < sizeof(void*) ? sizeof(void*) : Size);
+
+        template <class F>
+        static constexpr bool is_inline_v = (sizeof(F) <= bufferSize) && (alignof(F) <= alignof(std::max_align_t)) && std::is_nothrow_move_constructible_v<F>;
+
+        struct operations
+        {
+            void (*invoke)(void*, Args...);
+            void (*relocate)(void*, void*) noexcept;
+            void (*destroy)(void*) noexcept;
+        };
+
+        template <class F>
+        struct inline_operations
+        {
+            static void invoke(void* storage, Args... args)
+            {
+                (*std::launder(static_cast<F*>(storage)))(std::forward<Args>(args)...);
+            }
+
+            static void relocate(void* destination, void* source) noexcept
+            {
+                F* f = std::launder(static_cast<F*>(source));
+                ::new (destination) F(std::move(*f));
+                f->~F();
+            }
+
+            static void destroy(void* storage) noexcept
+            {
+                std::launder(static_cast<F*>(storage))->~F();
+            }
+
+            static constexpr operations ops{&invoke, &relocate, &destroy};
+        };
+
+        template <class F>
+        struct heap_operations
+        {
+            static F* pointer(void* storage) noexcept
+            {
+                return *std::launder(static_cast<F**>(storage));
+            }
+
+            static void invoke(void* storage, Args... args)
+            {
+                (*pointer(storage))(std::forward<Args>(args)...);
+            }
+
+            static void relocate(void* destination, void* source) noexcept
+            {
+                ::new (destination) F*(pointer(source));
+            }
+
+            static void destroy(void* storage) noexcept
+            {
+                delete pointer(storage);
+            }
+
+            static constexpr operations ops{&invoke, &relocate, &destroy};
+        };
+
+    public:
+        any_callable() noexcept
+            : vtable(nullptr)
+        {
+        }
+
+        template <class FP, class F = std::decay_t<FP>,
+                  std::enable_if_t<!std::is_same_v<F, any_callable>, int> = 0,
+                  std::enable_if_t<std::is_constructible_v<F, FP>, int> = 0,
+                  std::enable_if_t<std::is_invocable_v<F&, Args...>, int> = 0>
+        any_callable(FP&& f) noexcept(is_inline_v<F> && std::is_nothrow_constructible_v<F, FP>)
+            : vtable(nullptr)
+        {
+            if constexpr (is_inline_v<F> == true)
+            {
+                ::new (static_cast<void*>(buffer)) F(std::forward<FP>(f));
+                vtable = &inline_operations<F>::ops;
+            }
+            else
+            {
+                ::new (static_cast<void*>(buffer)) F*(new F(std::forward<FP>(f)));
+                vtable = &heap_operations<F>::ops;
+            }
+        }
+
+        any_callable(any_callable&& other) noexcept
+            : vtable(other.vtable)
+        {
+            if (vtable != nullptr)
+            {
+                vtable->relocate(buffer, other.buffer);
+                other.vtable = nullptr;
+            }
+        }
+
+        any_callable(const any_callable&) = delete;
+
+        ~any_callable()
+        {
+            reset();
+        }
+
+
+        void operator()(Args... args) const
+        {
+            vtable->invoke(const_cast<std::byte*>(buffer), std::forward<Args>(args)...);
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return vtable != nullptr;
+        }
+
+        void reset() noexcept
+        {
+            if (vtable != nullptr)
+            {
+                vtable->destroy(buffer);
+                vtable = nullptr;
+            }
+        }
+
+
+        any_callable& operator=(any_callable&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+
+                if (other.vtable != nullptr)
+                {
+                    other.vtable->relocate(buffer, other.buffer);
+                    vtable = std::exchange(other.vtable, nullptr);
+                }
+            }
+            return *this;
+        }
+
+        any_callable& operator=(const any_callable&) = delete;
+
+
+    private:
+        alignas(std::max_align_t) std::byte buffer[bufferSize];
+        const operations* vtable;
+    };
+
+}
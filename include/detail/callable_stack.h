@@ -0,0 +1,274 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sr::detail
+{
+    struct callable_ops
+    {
+        void (*invoke)(void*);
+        void (*destroy)(void*) noexcept;
+        std::size_t alignment;
+    };
+
+
+    template <class F>
+    struct callable_traits
+    {
+        static void invoke(void* object)
+        {
+            (*static_cast<F*>(object))();
+        }
+
+        static void destroy(void* object) noexcept
+        {
+            static_cast<F*>(object)->~F();
+        }
+
+        static constexpr callable_ops ops{&invoke, (std::is_trivially_destructible_v<F> ? nullptr : &destroy), alignof(F)};
+    };
+
+
+    template <std::size_t N>
+    class callable_stack
+    {
+    public:
+        using marker = std::size_t;
+
+        callable_stack() noexcept
+            : base(buffer),
+              capacity(N),
+              top(0),
+              blocks(nullptr),
+              entries(0),
+              nonTrivialEntries(0)
+        {
+        }
+
+        callable_stack(const callable_stack&) = delete;
+
+        ~callable_stack()
+        {
+            clear();
+        }
+
+
+        template <class F, class FP>
+        void push(FP&& callable)
+        {
+            static_assert(alignof(F) <= alignof(std::max_align_t), "Over-aligned callables are not supported");
+
+            std::size_t start = top;
+            std::size_t object = align_up(start, alignof(F));
+            std::size_t end = align_up(object + sizeof(F), alignof(entry)) + sizeof(entry);
+
+            if (end > capacity)
+            {
+                grow(align_up(sizeof(F), alignof(entry)) + sizeof(entry));
+                start = 0;
+                object = 0;
+                end = align_up(sizeof(F), alignof(entry)) + sizeof(entry);
+            }
+
+            ::new (static_cast<void*>(base + object)) F(std::forward<FP>(callable));
+            ::new (static_cast<void*>(base + end - sizeof(entry))) entry{&callable_traits<F>::ops, start};
+
+            top = end;
+            ++entries;
+
+            if constexpr (std::is_trivially_destructible_v<F> == false)
+            {
+                ++nonTrivialEntries;
+            }
+        }
+
+        void run_to(marker m)
+        {
+            while (entries > m)
+            {
+                pop<true>();
+            }
+            release_empty_blocks();
+        }
+
+        void clear_to(marker m) noexcept
+        {
+            if (m == 0 && nonTrivialEntries == 0)
+            {
+                entries = 0;
+                release_blocks();
+                top = 0;
+                return;
+            }
+
+            while (entries > m)
+            {
+                pop<false>();
+            }
+            release_empty_blocks();
+        }
+
+        void run()
+        {
+            run_to(0);
+        }
+
+        void clear() noexcept
+        {
+            clear_to(0);
+        }
+
+        marker mark() const noexcept
+        {
+            return entries;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return entries;
+        }
+
+        bool empty() const noexcept
+        {
+            return entries == 0;
+        }
+
+        bool trivially_clearable() const noexcept
+        {
+            return nonTrivialEntries == 0;
+        }
+
+
+        callable_stack& operator=(const callable_stack&) = delete;
+
+
+    private:
+        struct entry
+        {
+            const callable_ops* ops;
+            std::size_t start;
+        };
+
+        struct alignas(std::max_align_t) block
+        {
+            block* previous;
+            std::byte* previousBase;
+            std::size_t previousCapacity;
+            std::size_t previousTop;
+        };
+
+
+        static constexpr std::size_t align_up(std::size_t offset, std::size_t alignment) noexcept
+        {
+            return (offset + alignment - 1) & ~(alignment - 1);
+        }
+
+        template <bool Invoke>
+        void pop()
+        {
+            release_empty_blocks();
+
+            const entry current = *std::launder(reinterpret_cast<entry*>(base + top - sizeof(entry)));
+            void* object = base + align_up(current.start, current.ops->alignment);
+            top = current.start;
+            --entries;
+
+            if (current.ops->destroy != nullptr)
+            {
+                --nonTrivialEntries;
+            }
+
+            struct destroy_on_exit
+            {
+                ~destroy_on_exit()
+                {
+                    if (ops->destroy != nullptr)
+                    {
+                        ops->destroy(object);
+                    }
+                }
+
+                const callable_ops* ops;
+                void* object;
+            } destroyGuard{current.ops, object};
+
+            if constexpr (Invoke == true)
+            {
+                current.ops->invoke(object);
+            }
+        }
+
+        void grow(std::size_t required)
+        {
+            const std::size_t newCapacity = std::max(required, capacity * 2);
+            void* memory = ::operator new(sizeof(block) + newCapacity);
+
+            blocks = ::new (memory) block{blocks, base, capacity, top};
+            base = reinterpret_cast<std::byte*>(blocks + 1);
+            capacity = newCapacity;
+            top = 0;
+        }
+
+        void release_block() noexcept
+        {
+            block* current = blocks;
+            base = current->previousBase;
+            capacity = current->previousCapacity;
+            top = current->previousTop;
+            blocks = current->previous;
+            ::operator delete(current);
+        }
+
+        void release_empty_blocks() noexcept
+        {
+            while (top == 0 && blocks != nullptr)
+            {
+                release_block();
+            }
+        }
+
+        void release_blocks() noexcept
+        {
+            while (blocks != nullptr)
+            {
+                release_block();
+            }
+        }
+
+
+        alignas(std::max_align_t) std::byte buffer[N > 0 ? N : 1];
+        std::byte* base;
+        std::size_t capacity;
+        std::size_t top;
+        block* blocks;
+        std::size_t entries;
+        std::size_t nonTrivialEntries;
+    };
+
+}
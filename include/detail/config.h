@@ -0,0 +1,53 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#if !defined(SCOPEGUARD_NO_EXCEPTIONS) && !defined(__cpp_exceptions) && !defined(_CPPUNWIND)
+#define SCOPEGUARD_NO_EXCEPTIONS
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SCOPEGUARD_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define SCOPEGUARD_COLD __declspec(noinline)
+#else
+#define SCOPEGUARD_COLD
+#endif
+
+#include <cstddef>
+
+namespace sr::detail
+{
+    inline constexpr std::size_t cache_line_size = 64;
+
+
+    template <bool Likely>
+    constexpr bool expect(bool condition) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_expect(static_cast<long>(condition), static_cast<long>(Likely)) != 0;
+#else
+        return condition;
+#endif
+    }
+}
@@ -0,0 +1,123 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "scope_guard_base.h"
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+namespace sr::detail
+{
+    template <std::size_t I>
+    using index_tag = std::integral_constant<std::size_t, I>;
+
+
+    template <class Strategy, class Indices, class... EFs>
+    class scope_guard_all_base;
+
+    template <class Strategy, std::size_t... Is, class... EFs>
+    class scope_guard_all_base<Strategy, std::index_sequence<Is...>, EFs...> : private Strategy, private Wrapper<EFs, index_tag<Is>>...
+    {
+        template <std::size_t I>
+        using ExitFunction = Wrapper<std::tuple_element_t<I, std::tuple<EFs...>>, index_tag<I>>;
+
+    public:
+        template <class... EFPs,
+                  std::enable_if_t<(sizeof...(EFPs) == sizeof...(EFs)), int> = 0,
+                  std::enable_if_t<(std::is_constructible_v<EFs, EFPs> && ...), int> = 0,
+                  std::enable_if_t<((std::is_lvalue_reference_v<EFPs> || std::is_nothrow_constructible_v<EFs, EFPs>) && ...), int> = 0>
+        explicit scope_guard_all_base(EFPs&&... exitFunctions) noexcept((std::is_nothrow_constructible_v<EFs, EFPs> && ...))
+            : Wrapper<EFs, index_tag<Is>>(std::forward<EFPs>(exitFunctions), construction_guard<Is>(exitFunctions))...,
+              execute_on_destruction(true)
+        {
+            SCOPEGUARD_INSTRUMENT_EVENT(Strategy, construct);
+        }
+
+        template <class Dummy = void, std::enable_if_t<((std::is_nothrow_move_constructible_v<EFs> || std::is_copy_constructible_v<EFs>) && ...), Dummy*> = nullptr>
+        scope_guard_all_base(scope_guard_all_base&& other) noexcept(((std::is_nothrow_move_constructible_v<EFs> || std::is_nothrow_copy_constructible_v<EFs>) && ...))
+            : Strategy(other),
+              Wrapper<EFs, index_tag<Is>>(forward_if_nothrow_move_constructible<EFs>(other.template exit_function<Is>().get()))...,
+              execute_on_destruction(other.execute_on_destruction)
+        {
+            other.execute_on_destruction = false;
+        }
+
+        scope_guard_all_base(const scope_guard_all_base&) = delete;
+
+
+        ~scope_guard_all_base() noexcept((is_noexcept_dtor_v<EFs, Strategy> && ...))
+        {
+            if (expect<Strategy::execution_likely>((execute_on_destruction == true) && (Strategy::should_execute() == true)))
+            {
+                SCOPEGUARD_INSTRUMENT_EXECUTE(Strategy, Strategy::failed());
+                execute(std::index_sequence<Is...>{});
+            }
+        }
+
+
+        void release() noexcept
+        {
+            SCOPEGUARD_INSTRUMENT_EVENT(Strategy, release);
+            execute_on_destruction = false;
+        }
+
+
+        scope_guard_all_base& operator=(const scope_guard_all_base&) = delete;
+        scope_guard_all_base& operator=(scope_guard_all_base&&) = delete;
+
+
+    private:
+        template <std::size_t I>
+        ExitFunction<I>& exit_function() noexcept
+        {
+            return *this;
+        }
+
+        template <std::size_t... Js>
+        void execute(std::index_sequence<Js...>)
+        {
+            (exit_function<sizeof...(Js) - 1 - Js>().get()(), ...);
+        }
+
+        template <std::size_t I, class EFP>
+        auto construction_guard(EFP& exitFunction) noexcept
+        {
+            auto onFailure = [this, &exitFunction]
+            {
+                exitFunction();
+
+                if (Strategy::should_execute() == true)
+                {
+                    execute(std::make_index_sequence<I>{});
+                }
+            };
+            return scope_guard_base<decltype(onFailure), construction_strategy>{std::move(onFailure)};
+        }
+
+
+        bool execute_on_destruction;
+    };
+
+}
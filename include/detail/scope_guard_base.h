@@ -22,6 +22,9 @@
 
 #pragma once
 
+#include "config.h"
+#include "instrument_hooks.h"
+#include "wrapper.h"
 #include <utility>
 #include <type_traits>
 
@@ -43,52 +46,97 @@ namespace sr::detail
     template <class F, class S>
     inline constexpr bool is_noexcept_dtor_v = is_noexcept_dtor<F, S>::value;
 
+    template <bool NoCopyFallback>
+    constexpr void diagnose_copy_fallback() noexcept
+    {
+#ifdef SCOPEGUARD_DIAGNOSE_COPY_FALLBACK
+        static_assert(NoCopyFallback, "Falls back to copying since the move operation may throw (SCOPEGUARD_DIAGNOSE_COPY_FALLBACK)");
+#endif
+    }
+
     template <class T>
-    constexpr decltype(auto) forward_if_nothrow_move_constructible(T&& arg)
+    constexpr decltype(auto) forward_if_nothrow_move_constructible(std::remove_reference_t<T>& arg) noexcept
     {
-        if constexpr (std::is_nothrow_move_constructible_v<T> == true)
+        if constexpr (std::is_lvalue_reference_v<T> == true)
         {
-            return std::forward<T>(arg);
+            return arg;
+        }
+        else
+        {
+            diagnose_copy_fallback<(std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)>();
+            return std::move_if_noexcept(arg);
         }
-        return arg;
     }
 
 
+    struct construction_strategy
+    {
+        static constexpr bool execution_likely = false;
+
+
+        constexpr bool should_execute() const noexcept
+        {
+            return true;
+        }
+
+        constexpr bool failed() const noexcept
+        {
+            return true;
+        }
+    };
+
+
     template <class EF, class Strategy>
-    class scope_guard_base : private Strategy
+    class scope_guard_base : private Strategy, private Wrapper<EF>
     {
     public:
         template <class EFP,
                   std::enable_if_t<std::is_constructible_v<EF, EFP>, int> = 0,
                   std::enable_if_t<(!std::is_lvalue_reference_v<EFP>) && std::is_nothrow_constructible_v<EF, EFP>, int> = 0>
         explicit scope_guard_base(EFP&& exitFunction) noexcept(std::is_nothrow_constructible_v<EF, EFP> || std::is_nothrow_constructible_v<EF, EFP&>)
-            : exitfunction(std::forward<EFP>(exitFunction)),
+            : Wrapper<EF>(std::forward<EFP>(exitFunction)),
+              execute_on_destruction(true)
+        {
+            SCOPEGUARD_INSTRUMENT_EVENT(Strategy, construct);
+        }
+
+        template <class... Args, std::enable_if_t<std::is_constructible_v<EF, Args...>, int> = 0>
+        explicit scope_guard_base(std::in_place_type_t<EF>, Args&&... args) noexcept(std::is_nothrow_constructible_v<EF, Args...>)
+            : Wrapper<EF>(std::in_place, std::forward<Args>(args)...),
               execute_on_destruction(true)
         {
+            SCOPEGUARD_INSTRUMENT_EVENT(Strategy, construct);
         }
 
         template <class EFP,
                   std::enable_if_t<std::is_constructible_v<EF, EFP>, int> = 0,
                   std::enable_if_t<std::is_lvalue_reference_v<EFP>, int> = 0>
         explicit scope_guard_base(EFP&& exitFunction)
+#ifndef SCOPEGUARD_NO_EXCEPTIONS
         try
-            : exitfunction(exitFunction),
+#endif
+            : Wrapper<EF>(exitFunction),
               execute_on_destruction(true)
         {
+            SCOPEGUARD_INSTRUMENT_EVENT(Strategy, construct);
         }
+#ifndef SCOPEGUARD_NO_EXCEPTIONS
         catch (...)
         {
+            SCOPEGUARD_INSTRUMENT_EVENT(Strategy, execute);
+            SCOPEGUARD_INSTRUMENT_EVENT(Strategy, fail);
             exitFunction();
             throw;
         }
+#endif
 
-        template <class EFP = EF, std::enable_if_t<(std::is_nothrow_move_constructible_v<EF> || std::is_copy_constructible_v<EF>), int> = 0>
+        template <class EFP = EF, std::enable_if_t<(std::is_nothrow_move_constructible_v<EFP> || std::is_copy_constructible_v<EFP>), int> = 0>
         scope_guard_base(scope_guard_base&& other) noexcept(std::is_nothrow_move_constructible_v<EF> || std::is_nothrow_copy_constructible_v<EF>)
             : Strategy(other),
-              exitfunction(forward_if_nothrow_move_constructible(other.exitfunction)),
+              Wrapper<EF>(forward_if_nothrow_move_constructible<EF>(other.get())),
               execute_on_destruction(other.execute_on_destruction)
         {
-            other.release();
+            other.execute_on_destruction = false;
         }
 
         scope_guard_base(const scope_guard_base&) = delete;
@@ -96,15 +144,17 @@ namespace sr::detail
 
         ~scope_guard_base() noexcept(is_noexcept_dtor_v<EF, Strategy>)
         {
-            if ((execute_on_destruction == true) && (this->should_execute() == true))
+            if (expect<Strategy::execution_likely>((execute_on_destruction == true) && (Strategy::should_execute() == true)))
             {
-                exitfunction();
+                SCOPEGUARD_INSTRUMENT_EXECUTE(Strategy, Strategy::failed());
+                this->get()();
             }
         }
 
 
         void release() noexcept
         {
+            SCOPEGUARD_INSTRUMENT_EVENT(Strategy, release);
             execute_on_destruction = false;
         }
 
@@ -114,8 +164,14 @@ namespace sr::detail
 
 
     private:
-        EF exitfunction;
         bool execute_on_destruction;
     };
 
+
+    template <class F>
+    scope_guard_base<F, construction_strategy> make_construction_guard(F&& onFailure) noexcept
+    {
+        return scope_guard_base<F, construction_strategy>{std::forward<F>(onFailure)};
+    }
+
 }
@@ -24,6 +24,7 @@
 
 #include <functional>
 #include <type_traits>
+#include <utility>
 
 namespace sr::detail
 {
@@ -35,59 +36,123 @@ namespace sr::detail
     };
 
 
+    template <class T, bool = std::is_class_v<T> && std::is_empty_v<T> && !std::is_final_v<T>>
+    class WrapperStorage
+    {
+    public:
+        template <class TT>
+        explicit WrapperStorage(TT&& v) noexcept(std::is_nothrow_constructible_v<T, TT>)
+            : storedValue(std::forward<TT>(v))
+        {
+        }
+
+        template <class... Args>
+        explicit WrapperStorage(std::in_place_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+            : storedValue(std::forward<Args>(args)...)
+        {
+        }
+
+
+        T& value() noexcept
+        {
+            return storedValue;
+        }
+
+        const T& value() const noexcept
+        {
+            return storedValue;
+        }
+
+
+    private:
+        T storedValue;
+    };
+
+
     template <class T>
-    class Wrapper
+    class WrapperStorage<T, true> : private T
+    {
+    public:
+        template <class TT>
+        explicit WrapperStorage(TT&& v) noexcept(std::is_nothrow_constructible_v<T, TT>)
+            : T(std::forward<TT>(v))
+        {
+        }
+
+        template <class... Args>
+        explicit WrapperStorage(std::in_place_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+            : T(std::forward<Args>(args)...)
+        {
+        }
+
+
+        T& value() noexcept
+        {
+            return *this;
+        }
+
+        const T& value() const noexcept
+        {
+            return *this;
+        }
+    };
+
+
+    template <class T, class Tag = void>
+    class Wrapper : private WrapperStorage<T>
     {
     public:
         template <class TT, class G = NoopGuard, std::enable_if_t<std::is_constructible_v<T, TT>, int> = 0>
         Wrapper(TT&& v, G&& g = G{}) noexcept(std::is_nothrow_constructible_v<T, TT>)
-            : value(std::forward<TT>(v))
+            : WrapperStorage<T>(std::forward<TT>(v))
         {
             g.release();
         }
 
+        template <class... Args>
+        explicit Wrapper(std::in_place_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+            : WrapperStorage<T>(std::in_place, std::forward<Args>(args)...)
+        {
+        }
+
 
         T& get() noexcept
         {
-            return value;
+            return this->value();
         }
 
         const T& get() const noexcept
         {
-            return value;
+            return this->value();
         }
 
-        void reset(Wrapper<T>&& other) noexcept
+        void reset(Wrapper&& other) noexcept
         {
-            value = std::move(other.value);
+            this->value() = std::move(other.value());
         }
 
-        void reset(const Wrapper<T>& other) noexcept(std::is_nothrow_assignable_v<T, const T&>)
+        void reset(const Wrapper& other) noexcept(std::is_nothrow_assignable_v<T, const T&>)
         {
-            value = other.value;
+            this->value() = other.value();
         }
 
         void reset(T&& newValue) noexcept(std::is_nothrow_assignable_v<T, decltype(std::move_if_noexcept(newValue))>)
         {
-            value = std::forward<T>(newValue);
+            this->value() = std::forward<T>(newValue);
         }
 
         void reset(const T& newValue) noexcept(std::is_nothrow_assignable_v<T, const T&>)
         {
-            value = newValue;
+            this->value() = newValue;
         }
 
 
         using type = T;
-
-
-    private:
-        T value;
     };
 
 
-    template <class T>
-    class Wrapper<T&>
+    template <class T, class Tag>
+    class Wrapper<T&, Tag>
     {
     public:
         template <class TT, class G = NoopGuard, std::enable_if_t<std::is_convertible_v<TT, T&>, int> = 0>
@@ -108,7 +173,7 @@ namespace sr::detail
             return value.get();
         }
 
-        void reset(Wrapper<T>&& other) noexcept
+        void reset(Wrapper&& other) noexcept
         {
             value = std::move(other.value);
         }
@@ -0,0 +1,285 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "any_scope_exit.h"
+#include "unique_resource.h"
+#include "detail/config.h"
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sr
+{
+    namespace detail
+    {
+        template <class Resource>
+        struct retired_deleter
+        {
+            void operator()()
+            {
+                resource.reset();
+            }
+
+
+            Resource resource;
+        };
+    }
+
+
+    class epoch_domain
+    {
+        struct alignas(detail::cache_line_size) slot
+        {
+            std::atomic<std::uint64_t> epoch{0};
+            std::atomic<bool> in_use{false};
+            std::size_t depth{0};
+        };
+
+        struct retired_resource
+        {
+            std::uint64_t epoch;
+            any_scope_exit<> deleter;
+        };
+
+    public:
+        static constexpr std::size_t default_max_readers = 64;
+
+
+        class guard
+        {
+        public:
+            guard(guard&& other) noexcept
+                : slotEpoch(std::exchange(other.slotEpoch, nullptr)),
+                  depth(std::exchange(other.depth, nullptr))
+            {
+            }
+
+            guard(const guard&) = delete;
+
+            ~guard()
+            {
+                if ((depth != nullptr) && (--*depth == 0))
+                {
+                    slotEpoch->store(0, std::memory_order_release);
+                }
+            }
+
+            guard& operator=(guard&&) = delete;
+            guard& operator=(const guard&) = delete;
+
+
+        private:
+            guard(std::atomic<std::uint64_t>& epoch, std::size_t& nesting, const std::atomic<std::uint64_t>& global) noexcept
+                : slotEpoch(&epoch),
+                  depth(&nesting)
+            {
+                if ((*depth)++ == 0)
+                {
+                    slotEpoch->store(global.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                }
+            }
+
+
+            std::atomic<std::uint64_t>* slotEpoch;
+            std::size_t* depth;
+
+            friend class epoch_domain;
+        };
+
+
+        class reader
+        {
+        public:
+            reader(reader&& other) noexcept
+                : domain(std::exchange(other.domain, nullptr)),
+                  readerSlot(std::exchange(other.readerSlot, nullptr))
+            {
+            }
+
+            reader(const reader&) = delete;
+
+            ~reader()
+            {
+                if (readerSlot != nullptr)
+                {
+                    readerSlot->in_use.store(false, std::memory_order_release);
+                }
+            }
+
+
+            guard pin() noexcept
+            {
+                assert((readerSlot != nullptr) && "pin() called on a moved-from reader");
+                return guard{readerSlot->epoch, readerSlot->depth, domain->globalEpoch};
+            }
+
+
+            reader& operator=(reader&&) = delete;
+            reader& operator=(const reader&) = delete;
+
+
+        private:
+            reader(epoch_domain& d, slot& s) noexcept
+                : domain(&d),
+                  readerSlot(&s)
+            {
+            }
+
+
+            epoch_domain* domain;
+            slot* readerSlot;
+
+            friend class epoch_domain;
+        };
+
+
+        explicit epoch_domain(std::size_t maxReaders = default_max_readers)
+            : slotCount(maxReaders),
+              slots(std::make_unique<slot[]>(maxReaders))
+        {
+        }
+
+        epoch_domain(const epoch_domain&) = delete;
+
+        ~epoch_domain()
+        {
+            const std::lock_guard<std::mutex> lock{mutex};
+            retiredResources.clear();
+        }
+
+
+        reader register_reader()
+        {
+            for (std::size_t i = 0; i < slotCount; ++i)
+            {
+                bool expected{false};
+
+                if (slots[i].in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel) == true)
+                {
+                    return reader{*this, slots[i]};
+                }
+            }
+#ifndef SCOPEGUARD_NO_EXCEPTIONS
+            throw std::length_error{"No free reader slot in epoch_domain"};
+#else
+            std::abort();
+#endif
+        }
+
+        template <class R, class D, class Ownership>
+        void retire(unique_resource<R, D, Ownership>&& resource)
+        {
+            using Deleter = detail::retired_deleter<unique_resource<R, D, Ownership>>;
+            static_assert(std::is_nothrow_constructible_v<any_scope_exit<>, Deleter>, "Resource must be nothrow move constructible and fit into any_scope_exit");
+
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+
+                retiredResources.push_back({0, any_scope_exit<>{}});
+
+                retired_resource& retired = retiredResources.back();
+                retired.deleter = any_scope_exit<>{Deleter{std::move(resource)}};
+                retired.epoch = globalEpoch.fetch_add(1, std::memory_order_acq_rel);
+            }
+
+            reclaim();
+        }
+
+        std::size_t reclaim()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const std::uint64_t minimum = min_active_epoch();
+            std::vector<retired_resource> reclaimable;
+
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+                auto itr = retiredResources.begin();
+
+                while ((itr != retiredResources.end()) && (itr->epoch < minimum))
+                {
+                    ++itr;
+                }
+
+                reclaimable.assign(std::make_move_iterator(retiredResources.begin()), std::make_move_iterator(itr));
+                retiredResources.erase(retiredResources.begin(), itr);
+            }
+
+            return reclaimable.size();
+        }
+
+        void synchronize()
+        {
+            while (retired() > 0)
+            {
+                reclaim();
+                std::this_thread::yield();
+            }
+        }
+
+        std::size_t retired() const
+        {
+            const std::lock_guard<std::mutex> lock{mutex};
+            return retiredResources.size();
+        }
+
+
+        epoch_domain& operator=(const epoch_domain&) = delete;
+
+
+    private:
+        std::uint64_t min_active_epoch() const noexcept
+        {
+            std::uint64_t minimum = globalEpoch.load(std::memory_order_acquire);
+
+            for (std::size_t i = 0; i < slotCount; ++i)
+            {
+                const std::uint64_t epoch = slots[i].epoch.load(std::memory_order_acquire);
+
+                if ((epoch != 0) && (epoch < minimum))
+                {
+                    minimum = epoch;
+                }
+            }
+            return minimum;
+        }
+
+
+        alignas(detail::cache_line_size) std::atomic<std::uint64_t> globalEpoch{1};
+        const std::size_t slotCount;
+        std::unique_ptr<slot[]> slots;
+        mutable std::mutex mutex;
+        std::vector<retired_resource> retiredResources;
+    };
+
+}
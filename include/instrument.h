@@ -0,0 +1,316 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "detail/config.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <typeinfo>
+#include <type_traits>
+#include <vector>
+
+#if defined(__has_include)
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#define SCOPEGUARD_HAS_CXXABI 1
+#endif
+#endif
+
+namespace sr
+{
+    struct instrument_counters
+    {
+        std::uint64_t construct;
+        std::uint64_t execute;
+        std::uint64_t release;
+        std::uint64_t fail;
+    };
+
+
+    struct instrument_entry
+    {
+        const char* name;
+        instrument_counters counters;
+    };
+
+
+    namespace detail
+    {
+        struct scope_exit_strategy;
+        struct scope_fail_strategy;
+        struct scope_success_strategy;
+        struct construction_strategy;
+    }
+
+
+    namespace detail
+    {
+        template <class Key>
+        const char* type_name() noexcept
+        {
+#ifdef SCOPEGUARD_HAS_CXXABI
+            int status{0};
+
+            if (char* demangled = abi::__cxa_demangle(typeid(Key).name(), nullptr, nullptr, &status); status == 0)
+            {
+                return demangled;
+            }
+#endif
+            return typeid(Key).name();
+        }
+    }
+
+
+    template <class Key>
+    inline const char* const instrument_name = detail::type_name<Key>();
+
+    template <>
+    inline const char* const instrument_name<detail::scope_exit_strategy> = "scope_exit";
+
+    template <>
+    inline const char* const instrument_name<detail::scope_fail_strategy> = "scope_fail";
+
+    template <>
+    inline const char* const instrument_name<detail::scope_success_strategy> = "scope_success";
+
+
+    namespace detail
+    {
+        inline constexpr std::size_t instrument_max_keys = 64;
+
+
+        enum class instrument_event : std::size_t
+        {
+            construct,
+            execute,
+            release,
+            fail
+        };
+
+
+        struct alignas(cache_line_size) instrument_slot
+        {
+            std::atomic<std::uint64_t> counts[4];
+        };
+
+
+        struct instrument_block
+        {
+            instrument_slot slots[instrument_max_keys]{};
+            instrument_block* next{nullptr};
+        };
+
+
+        class instrument_registry
+        {
+        public:
+            static instrument_registry& instance() noexcept
+            {
+                alignas(instrument_registry) static unsigned char storage[sizeof(instrument_registry)];
+                static instrument_registry* const registry = ::new (static_cast<void*>(storage)) instrument_registry;
+                return *registry;
+            }
+
+
+            std::size_t register_key(const char* name) noexcept
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+
+                if (nameCount < instrument_max_keys - 1)
+                {
+                    names[nameCount] = name;
+                    return nameCount++;
+                }
+                if (nameCount == instrument_max_keys - 1)
+                {
+                    names[nameCount++] = "other";
+                }
+                return instrument_max_keys - 1;
+            }
+
+            void attach(instrument_block& block) noexcept
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+                block.next = blocks;
+                blocks = &block;
+            }
+
+            void detach(instrument_block& block) noexcept
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+                add(retired, block);
+
+                instrument_block** link = &blocks;
+
+                while (*link != &block)
+                {
+                    link = &(*link)->next;
+                }
+                *link = block.next;
+            }
+
+            std::vector<instrument_entry> snapshot(const instrument_block* only) const
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+                instrument_counters sums[instrument_max_keys]{};
+
+                if (only != nullptr)
+                {
+                    add(sums, *only);
+                }
+                else
+                {
+                    add(sums, retired);
+
+                    for (const instrument_block* block = blocks; block != nullptr; block = block->next)
+                    {
+                        add(sums, *block);
+                    }
+                }
+
+                std::vector<instrument_entry> entries;
+                entries.reserve(nameCount);
+
+                for (std::size_t i = 0; i < nameCount; ++i)
+                {
+                    entries.push_back(instrument_entry{names[i], sums[i]});
+                }
+                return entries;
+            }
+
+
+        private:
+            instrument_registry() noexcept = default;
+
+
+            static void add(instrument_counters (&sums)[instrument_max_keys], const instrument_block& block) noexcept
+            {
+                for (std::size_t i = 0; i < instrument_max_keys; ++i)
+                {
+                    const auto& counts = block.slots[i].counts;
+                    sums[i].construct += counts[0].load(std::memory_order_relaxed);
+                    sums[i].execute += counts[1].load(std::memory_order_relaxed);
+                    sums[i].release += counts[2].load(std::memory_order_relaxed);
+                    sums[i].fail += counts[3].load(std::memory_order_relaxed);
+                }
+            }
+
+            static void add(instrument_counters (&sums)[instrument_max_keys], const instrument_counters (&counters)[instrument_max_keys]) noexcept
+            {
+                for (std::size_t i = 0; i < instrument_max_keys; ++i)
+                {
+                    sums[i].construct += counters[i].construct;
+                    sums[i].execute += counters[i].execute;
+                    sums[i].release += counters[i].release;
+                    sums[i].fail += counters[i].fail;
+                }
+            }
+
+
+            mutable std::mutex mutex;
+            const char* names[instrument_max_keys]{};
+            std::size_t nameCount{0};
+            instrument_block* blocks{nullptr};
+            instrument_counters retired[instrument_max_keys]{};
+        };
+
+
+        class instrument_thread_block
+        {
+        public:
+            instrument_thread_block() noexcept
+            {
+                instrument_registry::instance().attach(block);
+            }
+
+            instrument_thread_block(const instrument_thread_block&) = delete;
+
+            ~instrument_thread_block()
+            {
+                instrument_registry::instance().detach(block);
+            }
+
+
+            instrument_thread_block& operator=(const instrument_thread_block&) = delete;
+
+
+            instrument_block block;
+        };
+
+
+        inline instrument_block& this_thread_instrument_block() noexcept
+        {
+            thread_local instrument_thread_block threadBlock;
+            return threadBlock.block;
+        }
+
+        template <class Key>
+        std::size_t instrument_key_index() noexcept
+        {
+            static const std::size_t index = instrument_registry::instance().register_key(instrument_name<Key>);
+            return index;
+        }
+
+        template <class Key>
+        inline constexpr bool is_instrumented_v = (std::is_same_v<Key, construction_strategy> == false);
+
+        template <class Key>
+        void instrument(instrument_event event) noexcept
+        {
+            if constexpr (is_instrumented_v<Key> == true)
+            {
+                auto& count = this_thread_instrument_block().slots[instrument_key_index<Key>()].counts[static_cast<std::size_t>(event)];
+                count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+        }
+
+        template <class Key>
+        void instrument_execute(bool failed) noexcept
+        {
+            if constexpr (is_instrumented_v<Key> == true)
+            {
+                instrument<Key>(instrument_event::execute);
+
+                if (failed == true)
+                {
+                    instrument<Key>(instrument_event::fail);
+                }
+            }
+        }
+    }
+
+
+    inline std::vector<instrument_entry> instrument_snapshot()
+    {
+        return detail::instrument_registry::instance().snapshot(nullptr);
+    }
+
+    inline std::vector<instrument_entry> instrument_thread_snapshot()
+    {
+        return detail::instrument_registry::instance().snapshot(&detail::this_thread_instrument_block());
+    }
+
+}
@@ -0,0 +1,242 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "unique_resource.h"
+#include "detail/wrapper.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace sr
+{
+    namespace detail
+    {
+        struct AcquireTag
+        {
+        };
+
+
+        struct acquire_waiters
+        {
+            std::mutex mutex;
+            std::condition_variable acquired;
+            std::atomic<std::size_t> count{0};
+        };
+
+        inline acquire_waiters& lazy_acquire_waiters() noexcept
+        {
+            static acquire_waiters waiters;
+            return waiters;
+        }
+    }
+
+
+    template <class R, class D, class Acquire, class Ownership = detail::ownership_flag>
+    class lazy_unique_resource : private detail::Wrapper<D, detail::DeleterTag>, private detail::Wrapper<Acquire, detail::AcquireTag>
+    {
+        using DeleterWrapper = detail::Wrapper<D, detail::DeleterTag>;
+        using AcquireWrapper = detail::Wrapper<Acquire, detail::AcquireTag>;
+
+        static_assert(std::is_invocable_v<const Acquire&>, "Acquire has to be invocable as const, mutable acquisition functions are not supported");
+
+        enum class state : unsigned char
+        {
+            empty,
+            acquiring,
+            owned,
+            released
+        };
+
+    public:
+        template <class AA, class DD,
+                  std::enable_if_t<(std::is_constructible_v<Acquire, AA> && std::is_constructible_v<D, DD>), int> = 0>
+        lazy_unique_resource(AA&& a, DD&& d) noexcept(std::is_nothrow_constructible_v<Acquire, AA> && std::is_nothrow_constructible_v<D, DD>)
+            : DeleterWrapper(std::forward<DD>(d)),
+              AcquireWrapper(std::forward<AA>(a))
+        {
+        }
+
+        lazy_unique_resource(const lazy_unique_resource&) = delete;
+
+        ~lazy_unique_resource()
+        {
+            reset();
+        }
+
+
+        const R& get() const
+        {
+            if (is_acquired(current.load(std::memory_order_acquire)) == false)
+            {
+                acquire_slow();
+            }
+            return *pointer();
+        }
+
+        template <class RR = R, std::enable_if_t<std::is_pointer_v<RR>, int> = 0>
+        RR operator->() const
+        {
+            return get();
+        }
+
+        template <class RR = R,
+                  std::enable_if_t<(std::is_pointer_v<RR> && !std::is_void_v<std::remove_pointer_t<RR>>), int> = 0>
+        std::add_lvalue_reference_t<std::remove_pointer_t<RR>> operator*() const
+        {
+            return *get();
+        }
+
+        bool acquired() const noexcept
+        {
+            return is_acquired(current.load(std::memory_order_acquire));
+        }
+
+        void reset() noexcept
+        {
+            const state previous = current.load(std::memory_order_relaxed);
+
+            if (previous != state::empty)
+            {
+                if ((previous == state::owned) && (Ownership::is_valid(*pointer()) == true))
+                {
+                    get_deleter()(*pointer());
+                }
+                pointer()->~R();
+                current.store(state::empty, std::memory_order_relaxed);
+            }
+        }
+
+        template <class RR>
+        void reset(RR&& r)
+        {
+            reset();
+
+            auto se = detail::make_construction_guard([this, &r]
+                                 {
+                                     if (Ownership::is_valid(r) == true)
+                                     {
+                                         get_deleter()(r);
+                                     }
+                                 });
+            ::new (static_cast<void*>(storage)) R(std::forward<RR>(r));
+            se.release();
+            current.store(state::owned, std::memory_order_release);
+        }
+
+        void release() noexcept
+        {
+            if (current.load(std::memory_order_relaxed) == state::owned)
+            {
+                current.store(state::released, std::memory_order_relaxed);
+            }
+        }
+
+        const D& get_deleter() const noexcept
+        {
+            return static_cast<const DeleterWrapper&>(*this).get();
+        }
+
+
+        lazy_unique_resource& operator=(const lazy_unique_resource&) = delete;
+
+
+    private:
+        static constexpr bool is_acquired(state s) noexcept
+        {
+            return (s == state::owned) || (s == state::released);
+        }
+
+        void acquire_slow() const
+        {
+            state expected = state::empty;
+
+            while (is_acquired(expected) == false)
+            {
+                if ((expected == state::empty) && (current.compare_exchange_weak(expected, state::acquiring, std::memory_order_acquire, std::memory_order_acquire) == true))
+                {
+                    auto se = detail::make_construction_guard([this]
+                                                              { finish_acquire(state::empty); });
+                    ::new (static_cast<void*>(storage)) R(std::invoke(static_cast<const AcquireWrapper&>(*this).get()));
+                    se.release();
+                    finish_acquire(state::owned);
+                    return;
+                }
+
+                if (expected == state::acquiring)
+                {
+                    expected = wait_for_acquire();
+                }
+            }
+        }
+
+        void finish_acquire(state s) const noexcept
+        {
+            current.store(s, std::memory_order_seq_cst);
+            detail::acquire_waiters& waiters = detail::lazy_acquire_waiters();
+
+            if (waiters.count.load(std::memory_order_seq_cst) > 0)
+            {
+                {
+                    const std::lock_guard<std::mutex> lock{waiters.mutex};
+                }
+                waiters.acquired.notify_all();
+            }
+        }
+
+        state wait_for_acquire() const
+        {
+            detail::acquire_waiters& waiters = detail::lazy_acquire_waiters();
+            std::unique_lock<std::mutex> lock{waiters.mutex};
+            waiters.count.fetch_add(1, std::memory_order_seq_cst);
+            state s = state::acquiring;
+            waiters.acquired.wait(lock, [this, &s]
+                                  {
+                                      s = current.load(std::memory_order_seq_cst);
+                                      return s != state::acquiring;
+                                  });
+            waiters.count.fetch_sub(1, std::memory_order_relaxed);
+            return s;
+        }
+
+
+        R* pointer() const noexcept
+        {
+            return std::launder(reinterpret_cast<R*>(storage));
+        }
+
+
+        alignas(R) mutable unsigned char storage[sizeof(R)];
+        mutable std::atomic<state> current{state::empty};
+    };
+
+
+    template <class A, class D>
+    lazy_unique_resource(A, D) -> lazy_unique_resource<std::decay_t<std::invoke_result_t<A&>>, D, A>;
+
+}
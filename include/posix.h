@@ -0,0 +1,174 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "cleanup_batch.h"
+#include "unique_resource.h"
+#include <cstdio>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+namespace sr::posix
+{
+    namespace detail
+    {
+        inline bool close_range(int first, int last) noexcept
+        {
+#if defined(SYS_close_range)
+            return ::syscall(SYS_close_range, static_cast<unsigned int>(first), static_cast<unsigned int>(last), 0u) == 0;
+#else
+            static_cast<void>(first);
+            static_cast<void>(last);
+            return false;
+#endif
+        }
+
+        inline void close_all(int first, int last) noexcept
+        {
+            if ((first < 0) || (first == last) || (close_range(first, last) == false))
+            {
+                for (int fd = first; fd <= last; ++fd)
+                {
+                    ::close(fd);
+                }
+            }
+        }
+    }
+
+
+    struct fd_deleter
+    {
+        void operator()(int fd) const noexcept
+        {
+            ::close(fd);
+        }
+
+        void operator()(resource_span<int> fds) const noexcept
+        {
+            std::size_t begin = 0;
+
+            while (begin < fds.size())
+            {
+                std::size_t end = begin + 1;
+
+                if ((end < fds.size()) && (fds[end] == fds[begin] - 1))
+                {
+                    while ((end < fds.size()) && (fds[end] == fds[end - 1] - 1))
+                    {
+                        ++end;
+                    }
+                    detail::close_all(fds[end - 1], fds[begin]);
+                }
+                else
+                {
+                    while ((end < fds.size()) && (fds[end] == fds[end - 1] + 1))
+                    {
+                        ++end;
+                    }
+                    detail::close_all(fds[begin], fds[end - 1]);
+                }
+
+                begin = end;
+            }
+        }
+    };
+
+
+    struct socket_deleter
+    {
+        void operator()(int fd) const noexcept
+        {
+            ::close(fd);
+        }
+    };
+
+
+    struct dir_deleter
+    {
+        void operator()(DIR* dir) const noexcept
+        {
+            ::closedir(dir);
+        }
+    };
+
+
+    struct file_deleter
+    {
+        void operator()(std::FILE* file) const noexcept
+        {
+            std::fclose(file);
+        }
+    };
+
+
+    using unique_fd = unique_resource<int, fd_deleter, sentinel<-1>>;
+    using unique_socket = unique_resource<int, socket_deleter, sentinel<-1>>;
+    using unique_dir = unique_resource<DIR*, dir_deleter, sentinel<nullptr>>;
+    using unique_FILE = unique_resource<std::FILE*, file_deleter, sentinel<nullptr>>;
+
+    static_assert(sizeof(unique_fd) == sizeof(int));
+    static_assert(sizeof(unique_socket) == sizeof(int));
+    static_assert(sizeof(unique_dir) == sizeof(DIR*));
+    static_assert(sizeof(unique_FILE) == sizeof(std::FILE*));
+
+
+    inline unique_fd open(const char* path, int flags, mode_t mode = 0) noexcept
+    {
+        return unique_fd{::open(path, flags, mode), fd_deleter{}};
+    }
+
+    inline unique_socket socket(int domain, int type, int protocol = 0) noexcept
+    {
+        return unique_socket{::socket(domain, type, protocol), socket_deleter{}};
+    }
+
+    inline unique_socket accept(const unique_socket& listener, sockaddr* address = nullptr, socklen_t* length = nullptr) noexcept
+    {
+        return unique_socket{::accept(listener.get(), address, length), socket_deleter{}};
+    }
+
+#if defined(__linux__)
+    inline unique_socket accept4(const unique_socket& listener, sockaddr* address, socklen_t* length, int flags) noexcept
+    {
+        return unique_socket{::accept4(listener.get(), address, length, flags), socket_deleter{}};
+    }
+#endif
+
+    inline unique_dir opendir(const char* path) noexcept
+    {
+        return unique_dir{::opendir(path), dir_deleter{}};
+    }
+
+    inline unique_FILE fopen(const char* path, const char* mode) noexcept
+    {
+        return unique_FILE{std::fopen(path, mode), file_deleter{}};
+    }
+
+}
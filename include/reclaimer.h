@@ -0,0 +1,416 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "detail/config.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace sr
+{
+    enum class overflow_policy
+    {
+        block,
+        delete_inline
+    };
+
+
+    struct reclaimer_stats
+    {
+        std::uint64_t enqueued;
+        std::uint64_t reclaimed;
+        std::uint64_t deleted_inline;
+        std::uint64_t depth;
+    };
+
+
+    namespace detail
+    {
+        template <class R>
+        class mpsc_ring
+        {
+            static_assert(std::is_nothrow_default_constructible_v<R> && std::is_nothrow_copy_assignable_v<R>, "Resource must be nothrow default constructible and copy assignable");
+
+        public:
+            explicit mpsc_ring(std::size_t capacity)
+                : mask(round_up(capacity) - 1),
+                  cells(std::make_unique<cell[]>(mask + 1))
+            {
+                for (std::size_t i = 0; i <= mask; ++i)
+                {
+                    cells[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+
+            bool try_push(const R& r) noexcept
+            {
+                std::size_t position = tail.load(std::memory_order_relaxed);
+
+                while (true)
+                {
+                    cell& c = cells[position & mask];
+                    const std::size_t sequence = c.sequence.load(std::memory_order_acquire);
+                    const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+                    if (diff == 0)
+                    {
+                        if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true)
+                        {
+                            c.value = r;
+                            c.sequence.store(position + 1, std::memory_order_release);
+                            return true;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = tail.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            bool try_pop(R& r) noexcept
+            {
+                cell& c = cells[head & mask];
+
+                if (c.sequence.load(std::memory_order_acquire) != head + 1)
+                {
+                    return false;
+                }
+
+                r = c.value;
+                c.sequence.store(head + mask + 1, std::memory_order_release);
+                ++head;
+                return true;
+            }
+
+            bool empty() const noexcept
+            {
+                return cells[head & mask].sequence.load(std::memory_order_acquire) != head + 1;
+            }
+
+            std::size_t capacity() const noexcept
+            {
+                return mask + 1;
+            }
+
+            std::size_t claimed() const noexcept
+            {
+                return tail.load(std::memory_order_acquire);
+            }
+
+            std::size_t consumed() const noexcept
+            {
+                return consumedCount.load(std::memory_order_acquire);
+            }
+
+            void mark_consumed() noexcept
+            {
+                consumedCount.store(head, std::memory_order_release);
+            }
+
+
+        private:
+            struct cell
+            {
+                std::atomic<std::size_t> sequence{0};
+                R value{};
+            };
+
+
+            static std::size_t round_up(std::size_t capacity) noexcept
+            {
+                std::size_t size = 1;
+
+                while (size < capacity)
+                {
+                    size <<= 1;
+                }
+                return size;
+            }
+
+
+            const std::size_t mask;
+            std::unique_ptr<cell[]> cells;
+            alignas(cache_line_size) std::atomic<std::size_t> tail{0};
+            alignas(cache_line_size) std::size_t head{0};
+            std::atomic<std::size_t> consumedCount{0};
+        };
+    }
+
+
+    template <class R, class D>
+    class reclaimer;
+
+
+    template <class R, class D>
+    class deferred
+    {
+    public:
+        explicit deferred(reclaimer<R, D>& r) noexcept
+            : owner(&r)
+        {
+        }
+
+
+        void operator()(const R& r) const noexcept(std::is_nothrow_invocable_v<D&, const R&>)
+        {
+            owner->push(r);
+        }
+
+
+    private:
+        reclaimer<R, D>* owner;
+    };
+
+
+    template <class R, class D>
+    class reclaimer
+    {
+    public:
+        static constexpr std::size_t default_capacity = 1024;
+
+
+        explicit reclaimer(std::size_t capacity = default_capacity, overflow_policy overflow = overflow_policy::block, D d = D{})
+            : queue(capacity),
+              deleter(std::move(d)),
+              policy(overflow),
+              worker([this]
+                     { run(); })
+        {
+        }
+
+        reclaimer(const reclaimer&) = delete;
+
+        ~reclaimer()
+        {
+            drain();
+        }
+
+
+        void push(const R& r) noexcept(std::is_nothrow_invocable_v<D&, const R&>)
+        {
+            producers.fetch_add(1, std::memory_order_seq_cst);
+
+            if (stopped.load(std::memory_order_seq_cst) == false)
+            {
+                if (queue.try_push(r) == false)
+                {
+                    if (policy == overflow_policy::delete_inline)
+                    {
+                        producers.fetch_sub(1, std::memory_order_release);
+                        deletedInline.fetch_add(1, std::memory_order_relaxed);
+                        deleter(r);
+                        return;
+                    }
+                    wait_for_space(r);
+                }
+
+                enqueued.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                producers.fetch_sub(1, std::memory_order_release);
+
+                if (sleeping.load(std::memory_order_relaxed) == true)
+                {
+                    wake();
+                }
+            }
+            else
+            {
+                producers.fetch_sub(1, std::memory_order_release);
+                deletedInline.fetch_add(1, std::memory_order_relaxed);
+                deleter(r);
+            }
+        }
+
+        void flush()
+        {
+            const auto ticket = queue.claimed();
+            std::unique_lock<std::mutex> lock{mutex};
+
+            ++flushing;
+            work.notify_one();
+            progress.wait(lock, [this, ticket]
+                          { return queue.consumed() >= ticket || stopped.load(std::memory_order_acquire) == true; });
+            --flushing;
+        }
+
+        void drain()
+        {
+            if (worker.joinable() == true)
+            {
+                flush();
+                {
+                    const std::lock_guard<std::mutex> lock{mutex};
+                    stopped.store(true, std::memory_order_seq_cst);
+                }
+                work.notify_one();
+                worker.join();
+            }
+        }
+
+        reclaimer_stats stats() const noexcept
+        {
+            const auto reclaimedCount = reclaimed.load(std::memory_order_acquire);
+            const auto enqueuedCount = enqueued.load(std::memory_order_acquire);
+            return {enqueuedCount, reclaimedCount, deletedInline.load(std::memory_order_relaxed), (enqueuedCount > reclaimedCount ? enqueuedCount - reclaimedCount : 0)};
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return queue.capacity();
+        }
+
+        deferred<R, D> get_deleter() noexcept
+        {
+            return deferred<R, D>{*this};
+        }
+
+
+        reclaimer& operator=(const reclaimer&) = delete;
+
+
+    private:
+        void wait_for_space(const R& r)
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+
+            ++blocked;
+            work.notify_one();
+            space.wait(lock, [this, &r]
+                       { return queue.try_push(r); });
+            --blocked;
+        }
+
+        void wake()
+        {
+            const std::lock_guard<std::mutex> lock{mutex};
+            work.notify_one();
+        }
+
+        std::size_t reclaim_available() noexcept
+        {
+            std::size_t count = 0;
+            R r{};
+
+            while (queue.try_pop(r) == true)
+            {
+                deleter(r);
+                ++count;
+                reclaimed.fetch_add(1, std::memory_order_release);
+                queue.mark_consumed();
+            }
+            return count;
+        }
+
+        void run()
+        {
+            while (true)
+            {
+                if (reclaim_available() > 0)
+                {
+                    notify_progress();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock{mutex};
+                sleeping.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (queue.empty() == true)
+                {
+                    if (stopped.load(std::memory_order_acquire) == true)
+                    {
+                        break;
+                    }
+
+                    if (flushing > 0)
+                    {
+                        progress.notify_all();
+                    }
+                    work.wait(lock);
+                }
+                sleeping.store(false, std::memory_order_relaxed);
+            }
+
+            while (producers.load(std::memory_order_seq_cst) > 0)
+            {
+                if (reclaim_available() > 0)
+                {
+                    notify_progress();
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+            reclaim_available();
+            notify_progress();
+        }
+
+        void notify_progress()
+        {
+            const std::lock_guard<std::mutex> lock{mutex};
+
+            if (flushing > 0)
+            {
+                progress.notify_all();
+            }
+            if (blocked > 0)
+            {
+                space.notify_all();
+            }
+        }
+
+
+        detail::mpsc_ring<R> queue;
+        D deleter;
+        const overflow_policy policy;
+        std::atomic<bool> stopped{false};
+        std::atomic<bool> sleeping{false};
+        std::atomic<std::size_t> producers{0};
+        std::size_t flushing{0};
+        std::size_t blocked{0};
+        alignas(detail::cache_line_size) std::atomic<std::uint64_t> enqueued{0};
+        alignas(detail::cache_line_size) std::atomic<std::uint64_t> reclaimed{0};
+        std::atomic<std::uint64_t> deletedInline{0};
+        std::mutex mutex;
+        std::condition_variable work;
+        std::condition_variable progress;
+        std::condition_variable space;
+        std::thread worker;
+    };
+
+}
@@ -0,0 +1,251 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "unique_resource.h"
+#include "detail/config.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sr
+{
+    struct pool_stats
+    {
+        std::uint64_t hits;
+        std::uint64_t misses;
+        std::uint64_t recycled;
+        std::uint64_t deleted;
+        std::uint64_t idle;
+    };
+
+
+    namespace detail
+    {
+        inline std::size_t pool_thread_index() noexcept
+        {
+            static std::atomic<std::size_t> next{0};
+            thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+    }
+
+
+    template <class R, class D, class Ownership = detail::ownership_flag>
+    class resource_pool;
+
+
+    template <class R, class D, class Ownership = detail::ownership_flag>
+    class pooled
+    {
+    public:
+        pooled() noexcept
+            : owner(nullptr)
+        {
+        }
+
+        explicit pooled(resource_pool<R, D, Ownership>& pool) noexcept
+            : owner(&pool)
+        {
+        }
+
+
+        void operator()(const R& r) const noexcept
+        {
+            owner->recycle(r);
+        }
+
+
+    private:
+        resource_pool<R, D, Ownership>* owner;
+    };
+
+
+    template <class R, class D, class Ownership>
+    class resource_pool
+    {
+        static_assert(std::is_nothrow_copy_constructible_v<R> && std::is_nothrow_move_constructible_v<R>, "Resource must be nothrow copy and move constructible");
+
+    public:
+        using handle_type = unique_resource<R, pooled<R, D, Ownership>, Ownership>;
+
+        static constexpr std::size_t default_max_idle = 64;
+
+
+        explicit resource_pool(std::size_t maxIdle = default_max_idle, std::size_t shards = 0, D d = D{})
+            : deleter(std::move(d)),
+              maxIdlePerShard(maxIdle),
+              shardCount(shards != 0 ? shards : std::max(1u, std::thread::hardware_concurrency())),
+              shardList(std::make_unique<shard[]>(shardCount))
+        {
+            for (std::size_t i = 0; i < shardCount; ++i)
+            {
+                shardList[i].idle.reserve(maxIdlePerShard);
+            }
+        }
+
+        resource_pool(const resource_pool&) = delete;
+
+        ~resource_pool()
+        {
+            trim();
+        }
+
+
+        template <class F>
+        handle_type acquire(F&& create)
+        {
+            shard& s = local_shard();
+            std::unique_lock<std::mutex> lock{s.mutex};
+
+            if (s.idle.empty() == false)
+            {
+                R r = std::move(s.idle.back());
+                s.idle.pop_back();
+                ++s.hits;
+                lock.unlock();
+                return handle_type{std::move(r), pooled<R, D, Ownership>{*this}};
+            }
+
+            ++s.misses;
+            lock.unlock();
+            return handle_type{std::forward<F>(create)(), pooled<R, D, Ownership>{*this}};
+        }
+
+        void discard(handle_type&& handle) noexcept
+        {
+            if (detail::unique_resource_access::owns(handle) == true)
+            {
+                const R r = handle.get();
+                handle.release();
+                deleter(r);
+
+                shard& s = local_shard();
+                const std::lock_guard<std::mutex> lock{s.mutex};
+                ++s.deleted;
+            }
+        }
+
+        void trim() noexcept
+        {
+            for (std::size_t i = 0; i < shardCount; ++i)
+            {
+                shard& s = shardList[i];
+                const std::lock_guard<std::mutex> lock{s.mutex};
+
+                for (const R& r : s.idle)
+                {
+                    deleter(r);
+                }
+                s.deleted += s.idle.size();
+                s.idle.clear();
+            }
+        }
+
+        pool_stats stats() const
+        {
+            pool_stats result{0, 0, 0, 0, 0};
+
+            for (std::size_t i = 0; i < shardCount; ++i)
+            {
+                const shard& s = shardList[i];
+                const std::lock_guard<std::mutex> lock{s.mutex};
+                result.hits += s.hits;
+                result.misses += s.misses;
+                result.recycled += s.recycled;
+                result.deleted += s.deleted;
+                result.idle += s.idle.size();
+            }
+            return result;
+        }
+
+        std::size_t max_idle() const noexcept
+        {
+            return maxIdlePerShard;
+        }
+
+        std::size_t shard_count() const noexcept
+        {
+            return shardCount;
+        }
+
+        const D& get_deleter() const noexcept
+        {
+            return deleter;
+        }
+
+
+        resource_pool& operator=(const resource_pool&) = delete;
+
+
+    private:
+        struct alignas(detail::cache_line_size) shard
+        {
+            mutable std::mutex mutex;
+            std::vector<R> idle;
+            std::uint64_t hits{0};
+            std::uint64_t misses{0};
+            std::uint64_t recycled{0};
+            std::uint64_t deleted{0};
+        };
+
+
+        shard& local_shard() noexcept
+        {
+            return shardList[detail::pool_thread_index() % shardCount];
+        }
+
+        void recycle(const R& r) noexcept
+        {
+            shard& s = local_shard();
+            std::unique_lock<std::mutex> lock{s.mutex};
+
+            if (s.idle.size() < maxIdlePerShard)
+            {
+                s.idle.push_back(r);
+                ++s.recycled;
+                return;
+            }
+
+            ++s.deleted;
+            lock.unlock();
+            deleter(r);
+        }
+
+
+        D deleter;
+        const std::size_t maxIdlePerShard;
+        const std::size_t shardCount;
+        std::unique_ptr<shard[]> shardList;
+
+        friend class pooled<R, D, Ownership>;
+    };
+
+}
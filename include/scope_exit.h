@@ -23,6 +23,8 @@
 #pragma once
 
 #include "detail/scope_guard_base.h"
+#include "detail/scope_guard_all_base.h"
+#include <exception>
 
 namespace sr
 {
@@ -31,10 +33,28 @@ namespace sr
 
         struct scope_exit_strategy
         {
+            static constexpr bool execution_likely = true;
+
+
             bool should_execute() const noexcept
             {
                 return true;
             }
+
+#if defined(SCOPEGUARD_INSTRUMENT) && !defined(SCOPEGUARD_NO_EXCEPTIONS)
+            bool failed() const noexcept
+            {
+                return std::uncaught_exceptions() > uncaught_on_creation;
+            }
+
+
+            int uncaught_on_creation = std::uncaught_exceptions();
+#else
+            constexpr bool failed() const noexcept
+            {
+                return false;
+            }
+#endif
         };
 
     }
@@ -54,4 +74,21 @@ namespace sr
     template <class EF>
     scope_exit(EF) -> scope_exit<EF>;
 
+    template <class EF, class... Args>
+    scope_exit(std::in_place_type_t<EF>, Args&&...) -> scope_exit<EF>;
+
+
+    template <class... EFs>
+    class scope_exit_all : public detail::scope_guard_all_base<detail::scope_exit_strategy, std::index_sequence_for<EFs...>, EFs...>
+    {
+        using ScopeGuardAllBase = detail::scope_guard_all_base<detail::scope_exit_strategy, std::index_sequence_for<EFs...>, EFs...>;
+
+    public:
+        using ScopeGuardAllBase::ScopeGuardAllBase;
+    };
+
+
+    template <class... EFs>
+    scope_exit_all(EFs...) -> scope_exit_all<EFs...>;
+
 }
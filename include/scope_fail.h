@@ -23,6 +23,7 @@
 #pragma once
 
 #include "detail/scope_guard_base.h"
+#include "detail/scope_guard_all_base.h"
 #include <exception>
 
 namespace sr
@@ -32,13 +33,33 @@ namespace sr
 
         struct scope_fail_strategy
         {
+            static constexpr bool execution_likely = false;
+
+
+#ifdef SCOPEGUARD_NO_EXCEPTIONS
+            constexpr bool should_execute() const noexcept
+            {
+                return false;
+            }
+
+            constexpr bool failed() const noexcept
+            {
+                return false;
+            }
+#else
             bool should_execute() const noexcept
             {
                 return std::uncaught_exceptions() > uncaught_on_creation;
             }
 
+            bool failed() const noexcept
+            {
+                return should_execute();
+            }
+
 
             int uncaught_on_creation = std::uncaught_exceptions();
+#endif
         };
 
     }
@@ -58,4 +79,21 @@ namespace sr
     template <class EF>
     scope_fail(EF) -> scope_fail<EF>;
 
+    template <class EF, class... Args>
+    scope_fail(std::in_place_type_t<EF>, Args&&...) -> scope_fail<EF>;
+
+
+    template <class... EFs>
+    class scope_fail_all : public detail::scope_guard_all_base<detail::scope_fail_strategy, std::index_sequence_for<EFs...>, EFs...>
+    {
+        using ScopeGuardAllBase = detail::scope_guard_all_base<detail::scope_fail_strategy, std::index_sequence_for<EFs...>, EFs...>;
+
+    public:
+        using ScopeGuardAllBase::ScopeGuardAllBase;
+    };
+
+
+    template <class... EFs>
+    scope_fail_all(EFs...) -> scope_fail_all<EFs...>;
+
 }
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "detail/scope_guard_base.h"
+#include "detail/scope_guard_all_base.h"
 #include <exception>
 
 namespace sr
@@ -32,6 +33,21 @@ namespace sr
 
         struct scope_success_strategy
         {
+            static constexpr bool execution_likely = true;
+
+
+            constexpr bool failed() const noexcept
+            {
+                return false;
+            }
+
+
+#ifdef SCOPEGUARD_NO_EXCEPTIONS
+            constexpr bool should_execute() const noexcept
+            {
+                return true;
+            }
+#else
             bool should_execute() const noexcept
             {
                 return std::uncaught_exceptions() <= uncaught_on_creation;
@@ -39,6 +55,7 @@ namespace sr
 
 
             int uncaught_on_creation = std::uncaught_exceptions();
+#endif
         };
 
 
@@ -65,4 +82,21 @@ namespace sr
     template <class EF>
     scope_success(EF) -> scope_success<EF>;
 
+    template <class EF, class... Args>
+    scope_success(std::in_place_type_t<EF>, Args&&...) -> scope_success<EF>;
+
+
+    template <class... EFs>
+    class scope_success_all : public detail::scope_guard_all_base<detail::scope_success_strategy, std::index_sequence_for<EFs...>, EFs...>
+    {
+        using ScopeGuardAllBase = detail::scope_guard_all_base<detail::scope_success_strategy, std::index_sequence_for<EFs...>, EFs...>;
+
+    public:
+        using ScopeGuardAllBase::ScopeGuardAllBase;
+    };
+
+
+    template <class... EFs>
+    scope_success_all(EFs...) -> scope_success_all<EFs...>;
+
 }
@@ -0,0 +1,143 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "scope_fail.h"
+#include "detail/wrapper.h"
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace sr
+{
+    namespace detail
+    {
+
+        template <class EF, bool OnFail>
+        class transaction_handler : private Wrapper<EF>
+        {
+        public:
+            using Wrapper<EF>::Wrapper;
+            using Wrapper<EF>::get;
+
+            static constexpr bool on_fail = OnFail;
+        };
+
+
+        template <class H>
+        inline constexpr bool is_noexcept_handler_v = H::on_fail || std::is_nothrow_invocable_v<decltype(std::declval<H&>().get())>;
+
+    }
+
+
+    template <class EF>
+    detail::transaction_handler<std::decay_t<EF>, true> on_fail(EF&& exitFunction) noexcept(std::is_nothrow_constructible_v<std::decay_t<EF>, EF>)
+    {
+        if constexpr (std::is_nothrow_constructible_v<std::decay_t<EF>, EF> == true)
+        {
+            return {std::forward<EF>(exitFunction)};
+        }
+        else
+        {
+            return {std::forward<EF>(exitFunction), detail::make_construction_guard([&exitFunction]
+                                                                                    { exitFunction(); })};
+        }
+    }
+
+    template <class EF>
+    detail::transaction_handler<std::decay_t<EF>, false> on_success(EF&& exitFunction) noexcept(std::is_nothrow_constructible_v<std::decay_t<EF>, EF>)
+    {
+        return {std::forward<EF>(exitFunction)};
+    }
+
+
+    template <class... Handlers>
+    class scope_transaction : private detail::scope_fail_strategy
+    {
+        static_assert((std::is_nothrow_move_constructible_v<Handlers> && ...), "Handlers must be nothrow move constructible");
+
+    public:
+        template <class... HS, std::enable_if_t<(sizeof...(HS) == sizeof...(Handlers)) && (std::is_constructible_v<Handlers, HS> && ...), int> = 0>
+        explicit scope_transaction(HS&&... hs) noexcept((std::is_nothrow_constructible_v<Handlers, HS> && ...))
+            : handlers(std::forward<HS>(hs)...),
+              execute_on_destruction(true)
+        {
+        }
+
+        scope_transaction(scope_transaction&& other) noexcept
+            : detail::scope_fail_strategy(other),
+              handlers(std::move(other.handlers)),
+              execute_on_destruction(other.execute_on_destruction)
+        {
+            other.release();
+        }
+
+        scope_transaction(const scope_transaction&) = delete;
+
+
+        ~scope_transaction() noexcept((detail::is_noexcept_handler_v<Handlers> && ...))
+        {
+            if (execute_on_destruction == true)
+            {
+                execute(detail::scope_fail_strategy::should_execute(), std::index_sequence_for<Handlers...>{});
+            }
+        }
+
+
+        void release() noexcept
+        {
+            execute_on_destruction = false;
+        }
+
+
+        scope_transaction& operator=(const scope_transaction&) = delete;
+        scope_transaction& operator=(scope_transaction&&) = delete;
+
+
+    private:
+        template <std::size_t... Is>
+        void execute(bool failed, std::index_sequence<Is...>)
+        {
+            (execute(std::get<sizeof...(Is) - 1 - Is>(handlers), failed), ...);
+        }
+
+        template <class EF, bool OnFail>
+        static void execute(detail::transaction_handler<EF, OnFail>& handler, bool failed)
+        {
+            if (failed == OnFail)
+            {
+                handler.get()();
+            }
+        }
+
+
+        std::tuple<Handlers...> handlers;
+        bool execute_on_destruction;
+    };
+
+
+    template <class... Handlers>
+    scope_transaction(Handlers...) -> scope_transaction<Handlers...>;
+
+}
@@ -0,0 +1,392 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "unique_resource.h"
+#include "detail/wrapper.h"
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace sr
+{
+    struct atomic_refcount
+    {
+        void increment() noexcept
+        {
+            count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        bool decrement() noexcept
+        {
+            return count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        std::size_t value() const noexcept
+        {
+            return count.load(std::memory_order_relaxed);
+        }
+
+
+        std::atomic<std::size_t> count{1};
+    };
+
+
+    struct local_refcount
+    {
+        void increment() noexcept
+        {
+            ++count;
+        }
+
+        bool decrement() noexcept
+        {
+            return --count == 0;
+        }
+
+        std::size_t value() const noexcept
+        {
+            return count;
+        }
+
+
+        std::size_t count{1};
+    };
+
+
+    struct intrusive_refcount
+    {
+    };
+
+
+    namespace detail
+    {
+        template <class R, class D, class RefCount>
+        class shared_resource_block : private Wrapper<R, ResourceTag>, private Wrapper<D, DeleterTag>
+        {
+            using ResourceWrapper = Wrapper<R, ResourceTag>;
+            using DeleterWrapper = Wrapper<D, DeleterTag>;
+
+        public:
+            template <class RR, class DD>
+            shared_resource_block(RR&& r, DD&& d) noexcept(std::is_nothrow_constructible_v<R, RR> && std::is_nothrow_constructible_v<D, DD>)
+                : ResourceWrapper(std::forward<RR>(r)),
+                  DeleterWrapper(std::forward<DD>(d))
+            {
+            }
+
+
+            const R& resource() const noexcept
+            {
+                return static_cast<const ResourceWrapper&>(*this).get();
+            }
+
+            const D& deleter() const noexcept
+            {
+                return static_cast<const DeleterWrapper&>(*this).get();
+            }
+
+
+            RefCount count;
+        };
+    }
+
+
+    template <class R, class D, class RefCount = atomic_refcount>
+    class shared_resource
+    {
+        using Block = detail::shared_resource_block<R, D, RefCount>;
+
+    public:
+        shared_resource() noexcept
+            : block(nullptr)
+        {
+        }
+
+        template <class RR, class DD,
+                  std::enable_if_t<(std::is_constructible_v<R, RR> && std::is_constructible_v<D, DD>), int> = 0>
+        shared_resource(RR&& r, DD&& d)
+            : block(make_block(std::forward<RR>(r), std::forward<DD>(d)))
+        {
+        }
+
+        template <class Ownership>
+        explicit shared_resource(unique_resource<R, D, Ownership>&& other)
+            : block(nullptr)
+        {
+            if (detail::unique_resource_access::owns(other) == true)
+            {
+                block = new Block{std::move_if_noexcept(detail::unique_resource_access::resource(other)),
+                                  std::move_if_noexcept(detail::unique_resource_access::deleter(other))};
+                other.release();
+            }
+        }
+
+        shared_resource(const shared_resource& other) noexcept
+            : block(other.block)
+        {
+            if (block != nullptr)
+            {
+                block->count.increment();
+            }
+        }
+
+        shared_resource(shared_resource&& other) noexcept
+            : block(std::exchange(other.block, nullptr))
+        {
+        }
+
+        ~shared_resource()
+        {
+            reset();
+        }
+
+
+        void reset() noexcept
+        {
+            if ((block != nullptr) && (block->count.decrement() == true))
+            {
+                block->deleter()(block->resource());
+                delete block;
+            }
+            block = nullptr;
+        }
+
+        const R& get() const noexcept
+        {
+            return block->resource();
+        }
+
+        template <class RR = R, std::enable_if_t<std::is_pointer_v<RR>, int> = 0>
+        RR operator->() const noexcept
+        {
+            return get();
+        }
+
+        template <class RR = R,
+                  std::enable_if_t<(std::is_pointer_v<RR> && !std::is_void_v<std::remove_pointer_t<RR>>), int> = 0>
+        std::add_lvalue_reference_t<std::remove_pointer_t<RR>> operator*() const noexcept
+        {
+            return *get();
+        }
+
+        const D& get_deleter() const noexcept
+        {
+            return block->deleter();
+        }
+
+        std::size_t use_count() const noexcept
+        {
+            return (block != nullptr ? block->count.value() : 0);
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return block != nullptr;
+        }
+
+
+        shared_resource& operator=(const shared_resource& other) noexcept
+        {
+            shared_resource{other}.swap(*this);
+            return *this;
+        }
+
+        shared_resource& operator=(shared_resource&& other) noexcept
+        {
+            shared_resource{std::move(other)}.swap(*this);
+            return *this;
+        }
+
+        void swap(shared_resource& other) noexcept
+        {
+            std::swap(block, other.block);
+        }
+
+
+    private:
+        template <class RR, class DD>
+        static Block* make_block(RR&& r, DD&& d)
+        {
+            auto guard = detail::make_construction_guard([&r, &d]
+                                    {
+                                        d(r);
+                                    });
+
+            Block* b = new Block{detail::forward_if_nothrow_constructible<R, RR>(std::forward<RR>(r)), detail::forward_if_nothrow_constructible<D, DD>(std::forward<DD>(d))};
+            guard.release();
+            return b;
+        }
+
+
+        Block* block;
+    };
+
+
+    template <class R, class D>
+    class shared_resource<R, D, intrusive_refcount> : private detail::Wrapper<R, detail::ResourceTag>, private detail::Wrapper<D, detail::DeleterTag>
+    {
+        using ResourceWrapper = detail::Wrapper<R, detail::ResourceTag>;
+        using DeleterWrapper = detail::Wrapper<D, detail::DeleterTag>;
+
+    public:
+        shared_resource()
+            : ResourceWrapper(R{}),
+              DeleterWrapper(D{}),
+              engaged(false)
+        {
+        }
+
+        template <class RR, class DD,
+                  std::enable_if_t<(std::is_constructible_v<R, RR> && std::is_constructible_v<D, DD>), int> = 0>
+        shared_resource(RR&& r, DD&& d) noexcept(std::is_nothrow_constructible_v<R, RR> && std::is_nothrow_constructible_v<D, DD>)
+            : ResourceWrapper(std::forward<RR>(r)),
+              DeleterWrapper(std::forward<DD>(d)),
+              engaged(true)
+        {
+        }
+
+        template <class Ownership>
+        explicit shared_resource(unique_resource<R, D, Ownership>&& other) noexcept(std::is_nothrow_move_constructible_v<R> && std::is_nothrow_move_constructible_v<D>)
+            : ResourceWrapper(std::move_if_noexcept(detail::unique_resource_access::resource(other))),
+              DeleterWrapper(std::move_if_noexcept(detail::unique_resource_access::deleter(other))),
+              engaged(detail::unique_resource_access::owns(other))
+        {
+            other.release();
+        }
+
+        shared_resource(const shared_resource& other) noexcept(std::is_nothrow_copy_constructible_v<R> && std::is_nothrow_copy_constructible_v<D>)
+            : ResourceWrapper(other.resource().get()),
+              DeleterWrapper(other.deleter().get()),
+              engaged(other.engaged)
+        {
+            if (engaged == true)
+            {
+                intrusive_add_ref(get());
+            }
+        }
+
+        shared_resource(shared_resource&& other) noexcept(std::is_nothrow_move_constructible_v<R> && std::is_nothrow_move_constructible_v<D>)
+            : ResourceWrapper(std::move_if_noexcept(other.resource().get())),
+              DeleterWrapper(std::move_if_noexcept(other.deleter().get())),
+              engaged(std::exchange(other.engaged, false))
+        {
+        }
+
+        ~shared_resource()
+        {
+            reset();
+        }
+
+
+        void reset() noexcept
+        {
+            if ((engaged == true) && (intrusive_release_ref(get()) == true))
+            {
+                get_deleter()(get());
+            }
+            engaged = false;
+        }
+
+        const R& get() const noexcept
+        {
+            return resource().get();
+        }
+
+        template <class RR = R, std::enable_if_t<std::is_pointer_v<RR>, int> = 0>
+        RR operator->() const noexcept
+        {
+            return get();
+        }
+
+        template <class RR = R,
+                  std::enable_if_t<(std::is_pointer_v<RR> && !std::is_void_v<std::remove_pointer_t<RR>>), int> = 0>
+        std::add_lvalue_reference_t<std::remove_pointer_t<RR>> operator*() const noexcept
+        {
+            return *get();
+        }
+
+        const D& get_deleter() const noexcept
+        {
+            return deleter().get();
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return engaged;
+        }
+
+
+        shared_resource& operator=(const shared_resource& other)
+        {
+            shared_resource copy{other};
+            return *this = std::move(copy);
+        }
+
+        shared_resource& operator=(shared_resource&& other) noexcept(std::is_nothrow_move_assignable_v<R> && std::is_nothrow_move_assignable_v<D>)
+        {
+            if (this != &other)
+            {
+                reset();
+                resource().reset(std::move(other.resource()));
+                deleter().reset(std::move(other.deleter()));
+                engaged = std::exchange(other.engaged, false);
+            }
+            return *this;
+        }
+
+
+    private:
+        ResourceWrapper& resource() noexcept
+        {
+            return *this;
+        }
+
+        const ResourceWrapper& resource() const noexcept
+        {
+            return *this;
+        }
+
+        DeleterWrapper& deleter() noexcept
+        {
+            return *this;
+        }
+
+        const DeleterWrapper& deleter() const noexcept
+        {
+            return *this;
+        }
+
+
+        bool engaged;
+    };
+
+
+    template <class R, class D>
+    shared_resource(R, D) -> shared_resource<R, D>;
+
+    template <class R, class D, class Ownership>
+    shared_resource(unique_resource<R, D, Ownership>&&) -> shared_resource<R, D>;
+
+}
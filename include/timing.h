@@ -0,0 +1,496 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "unique_resource.h"
+#include "instrument.h"
+#include "detail/config.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+#if !defined(SCOPEGUARD_TIMING_NO_TSC) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SCOPEGUARD_TIMING_TSC
+#include <x86intrin.h>
+#elif !defined(SCOPEGUARD_TIMING_NO_TSC) && defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define SCOPEGUARD_TIMING_TSC
+#include <intrin.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+#endif
+
+namespace sr
+{
+    class timing_clock
+    {
+    public:
+        static std::uint64_t now() noexcept
+        {
+#if defined(SCOPEGUARD_TIMING_TSC)
+            return __rdtsc();
+#elif defined(CLOCK_MONOTONIC_COARSE)
+            timespec ts{};
+            ::clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+            return static_cast<std::uint64_t>(ts.tv_sec) * 1'000'000'000u + static_cast<std::uint64_t>(ts.tv_nsec);
+#else
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+
+        static double nanoseconds_per_tick()
+        {
+#if defined(SCOPEGUARD_TIMING_TSC)
+            static const double ratio = calibrate();
+            return ratio;
+#else
+            return 1.0;
+#endif
+        }
+
+        static std::uint64_t to_nanoseconds(std::uint64_t ticks)
+        {
+            const auto nanoseconds = static_cast<double>(ticks) * nanoseconds_per_tick();
+            constexpr auto limit = static_cast<double>(~std::uint64_t{0});
+            return (nanoseconds < limit) ? static_cast<std::uint64_t>(nanoseconds) : ~std::uint64_t{0};
+        }
+
+
+    private:
+#if defined(SCOPEGUARD_TIMING_TSC)
+        static double calibrate()
+        {
+            using clock = std::chrono::steady_clock;
+            const auto start = clock::now();
+            const auto startTicks = now();
+            auto end = start;
+
+            while ((end - start) < std::chrono::milliseconds{10})
+            {
+                end = clock::now();
+            }
+            const auto ticks = now() - startTicks;
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            return (ticks > 0) ? (static_cast<double>(elapsed) / static_cast<double>(ticks)) : 1.0;
+        }
+#endif
+    };
+
+
+    class timing_histogram
+    {
+    public:
+        static constexpr std::size_t sub_bucket_bits = 3;
+        static constexpr std::size_t sub_bucket_count = std::size_t{1} << sub_bucket_bits;
+        static constexpr std::size_t bucket_count = (64 - sub_bucket_bits + 1) * sub_bucket_count;
+
+
+        static constexpr std::size_t bucket_index(std::uint64_t value) noexcept
+        {
+            if (value < sub_bucket_count)
+            {
+                return static_cast<std::size_t>(value);
+            }
+            const auto exponent = highest_bit(value);
+            const auto mantissa = static_cast<std::size_t>(value >> (exponent - sub_bucket_bits)) & (sub_bucket_count - 1);
+            return (exponent - sub_bucket_bits + 1) * sub_bucket_count + mantissa;
+        }
+
+        static constexpr std::uint64_t bucket_lower_bound(std::size_t index) noexcept
+        {
+            if (index < sub_bucket_count)
+            {
+                return index;
+            }
+            const auto exponent = index / sub_bucket_count - 1 + sub_bucket_bits;
+            const auto mantissa = index % sub_bucket_count;
+            return std::uint64_t{sub_bucket_count + mantissa} << (exponent - sub_bucket_bits);
+        }
+
+        static constexpr std::uint64_t bucket_upper_bound(std::size_t index) noexcept
+        {
+            return (index + 1 < bucket_count) ? (bucket_lower_bound(index + 1) - 1) : ~std::uint64_t{0};
+        }
+
+
+        void record(std::uint64_t value, std::uint64_t times = 1) noexcept
+        {
+            buckets[bucket_index(value)] += times;
+            total += times;
+        }
+
+        void merge(const timing_histogram& other) noexcept
+        {
+            for (std::size_t i = 0; i < bucket_count; ++i)
+            {
+                buckets[i] += other.buckets[i];
+            }
+            total += other.total;
+        }
+
+        std::uint64_t count() const noexcept
+        {
+            return total;
+        }
+
+        std::uint64_t count(std::size_t index) const noexcept
+        {
+            return buckets[index];
+        }
+
+        std::uint64_t value_at_quantile(double quantile) const noexcept
+        {
+            if (total == 0)
+            {
+                return 0;
+            }
+            const auto rank = static_cast<std::uint64_t>(quantile * static_cast<double>(total - 1)) + 1;
+            std::uint64_t seen{0};
+
+            for (std::size_t i = 0; i < bucket_count; ++i)
+            {
+                seen += buckets[i];
+
+                if (seen >= rank)
+                {
+                    return bucket_upper_bound(i);
+                }
+            }
+            return bucket_upper_bound(bucket_count - 1);
+        }
+
+
+    private:
+        static constexpr std::size_t highest_bit(std::uint64_t value) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63 - static_cast<std::size_t>(__builtin_clzll(value));
+#else
+            std::size_t bit{0};
+
+            while ((value >>= 1) != 0)
+            {
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+
+
+        std::array<std::uint64_t, bucket_count> buckets{};
+        std::uint64_t total{0};
+    };
+
+
+    struct timing_entry
+    {
+        const char* name;
+        timing_histogram release_time;
+        timing_histogram lifetime;
+    };
+
+
+    namespace detail
+    {
+        struct atomic_timing_histogram
+        {
+            void record(std::uint64_t value) noexcept
+            {
+                auto& bucket = buckets[timing_histogram::bucket_index(value)];
+                bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+            void load_into(timing_histogram& histogram) const noexcept
+            {
+                for (std::size_t i = 0; i < timing_histogram::bucket_count; ++i)
+                {
+                    histogram.record(timing_histogram::bucket_lower_bound(i), buckets[i].load(std::memory_order_relaxed));
+                }
+            }
+
+
+            std::atomic<std::uint64_t> buckets[timing_histogram::bucket_count]{};
+        };
+
+
+        struct alignas(cache_line_size) timing_block
+        {
+            atomic_timing_histogram release_time;
+            atomic_timing_histogram lifetime;
+            timing_block* next{nullptr};
+            bool in_use{true};
+        };
+
+
+        struct timing_key
+        {
+            const char* name;
+            void (*snapshot)(timing_entry&);
+            timing_key* next;
+        };
+
+
+        class timing_key_list
+        {
+        public:
+            static timing_key_list& instance() noexcept
+            {
+                alignas(timing_key_list) static unsigned char storage[sizeof(timing_key_list)];
+                static timing_key_list* const list = ::new (static_cast<void*>(storage)) timing_key_list;
+                return *list;
+            }
+
+
+            void add(timing_key& key) noexcept
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+                *tail = &key;
+                tail = &key.next;
+            }
+
+            std::vector<timing_entry> snapshot() const
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+                std::vector<timing_entry> entries;
+
+                for (const timing_key* key = head; key != nullptr; key = key->next)
+                {
+                    entries.push_back(timing_entry{key->name, {}, {}});
+                    key->snapshot(entries.back());
+                }
+                return entries;
+            }
+
+
+        private:
+            timing_key_list() noexcept = default;
+
+
+            mutable std::mutex mutex;
+            timing_key* head{nullptr};
+            timing_key** tail{&head};
+        };
+
+
+        template <class Key>
+        class timing_registry
+        {
+        public:
+            static timing_registry& instance() noexcept
+            {
+                alignas(timing_registry) static unsigned char storage[sizeof(timing_registry)];
+                static timing_registry* const registry = ::new (static_cast<void*>(storage)) timing_registry;
+                return *registry;
+            }
+
+
+            timing_block* acquire_block() noexcept
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+
+                for (timing_block* block = blocks; block != nullptr; block = block->next)
+                {
+                    if (block->in_use == false)
+                    {
+                        block->in_use = true;
+                        return block;
+                    }
+                }
+
+                timing_block* block = new (std::nothrow) timing_block;
+
+                if (block != nullptr)
+                {
+                    block->next = blocks;
+                    blocks = block;
+                }
+                return block;
+            }
+
+            void release_block(timing_block* block) noexcept
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+                block->in_use = false;
+            }
+
+            void snapshot(timing_entry& entry) const
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+
+                for (const timing_block* block = blocks; block != nullptr; block = block->next)
+                {
+                    block->release_time.load_into(entry.release_time);
+                    block->lifetime.load_into(entry.lifetime);
+                }
+            }
+
+
+        private:
+            timing_registry() noexcept
+            {
+                timing_key_list::instance().add(key);
+            }
+
+
+            mutable std::mutex mutex;
+            timing_block* blocks{nullptr};
+            timing_key key{instrument_name<Key>, [](timing_entry& entry)
+                           { instance().snapshot(entry); },
+                           nullptr};
+        };
+
+
+        template <class Key>
+        class timing_thread_block
+        {
+        public:
+            timing_thread_block() noexcept
+                : block(timing_registry<Key>::instance().acquire_block())
+            {
+            }
+
+            timing_thread_block(const timing_thread_block&) = delete;
+
+            ~timing_thread_block()
+            {
+                if (block != nullptr)
+                {
+                    timing_registry<Key>::instance().release_block(block);
+                }
+            }
+
+
+            timing_thread_block& operator=(const timing_thread_block&) = delete;
+
+
+            timing_block* const block;
+        };
+
+
+        template <class Key>
+        timing_block* this_thread_timing_block() noexcept
+        {
+            thread_local timing_thread_block<Key> threadBlock;
+            return threadBlock.block;
+        }
+    }
+
+
+    template <class Ownership = detail::ownership_flag, class Tag = void>
+    class timed : private Ownership
+    {
+    public:
+        template <class R>
+        constexpr bool owns(const R& r) const noexcept
+        {
+            return Ownership::owns(r);
+        }
+
+        template <class R>
+        void own(R& r) noexcept
+        {
+            Ownership::own(r);
+            acquired = timing_clock::now();
+        }
+
+        template <class R>
+        constexpr void disown(R& r) noexcept
+        {
+            Ownership::disown(r);
+        }
+
+        template <class R, class D>
+        void dispose(R& r, const D& d) noexcept
+        {
+            using Key = std::conditional_t<std::is_void_v<Tag>, D, Tag>;
+            const auto start = timing_clock::now();
+            Ownership::dispose(r, d);
+            const auto end = timing_clock::now();
+
+            if (auto* block = detail::this_thread_timing_block<Key>(); block != nullptr)
+            {
+                block->release_time.record((end > start) ? (end - start) : 0);
+                block->lifetime.record((start > acquired) ? (start - acquired) : 0);
+            }
+        }
+
+        template <class R>
+        static constexpr bool is_valid(const R& r) noexcept
+        {
+            return Ownership::is_valid(r);
+        }
+
+
+    private:
+        std::uint64_t acquired{0};
+    };
+
+
+    template <class R, class D, class Ownership = detail::ownership_flag, class Tag = void>
+    using timed_unique_resource = unique_resource<R, D, timed<Ownership, Tag>>;
+
+
+    inline std::vector<timing_entry> timing_snapshot()
+    {
+        return detail::timing_key_list::instance().snapshot();
+    }
+
+    template <class Key>
+    timing_entry timing_snapshot()
+    {
+        timing_entry entry{instrument_name<Key>, {}, {}};
+        detail::timing_registry<Key>::instance().snapshot(entry);
+        return entry;
+    }
+
+    inline void dump_timing(std::ostream& out, const timing_histogram& histogram)
+    {
+        for (std::size_t i = 0; i < timing_histogram::bucket_count; ++i)
+        {
+            if (histogram.count(i) > 0)
+            {
+                out << "  [" << timing_clock::to_nanoseconds(timing_histogram::bucket_lower_bound(i)) << ", "
+                    << timing_clock::to_nanoseconds(timing_histogram::bucket_upper_bound(i)) << "] ns: " << histogram.count(i) << '\n';
+            }
+        }
+    }
+
+    inline void dump_timing(std::ostream& out, const std::vector<timing_entry>& entries)
+    {
+        for (const auto& entry : entries)
+        {
+            out << entry.name << " release time (" << entry.release_time.count() << " samples, p99 "
+                << timing_clock::to_nanoseconds(entry.release_time.value_at_quantile(0.99)) << " ns)\n";
+            dump_timing(out, entry.release_time);
+            out << entry.name << " lifetime (" << entry.lifetime.count() << " samples, p99 "
+                << timing_clock::to_nanoseconds(entry.lifetime.value_at_quantile(0.99)) << " ns)\n";
+            dump_timing(out, entry.lifetime);
+        }
+    }
+}
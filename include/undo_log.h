@@ -0,0 +1,110 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "scope_fail.h"
+#include "detail/callable_stack.h"
+#include "detail/scope_guard_base.h"
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace sr
+{
+    template <std::size_t N = 256>
+    class undo_log : private detail::scope_fail_strategy
+    {
+        using Actions = detail::callable_stack<N>;
+
+    public:
+        using savepoint_type = typename Actions::marker;
+
+
+        undo_log() noexcept = default;
+
+        undo_log(const undo_log&) = delete;
+
+        ~undo_log()
+        {
+            if (detail::expect<detail::scope_fail_strategy::execution_likely>(detail::scope_fail_strategy::should_execute()))
+            {
+                actions.run();
+            }
+        }
+
+
+        template <class RFP,
+                  std::enable_if_t<std::is_constructible_v<std::decay_t<RFP>, RFP>, int> = 0,
+                  std::enable_if_t<std::is_invocable_v<std::decay_t<RFP>&>, int> = 0,
+                  std::enable_if_t<std::is_lvalue_reference_v<RFP> || std::is_nothrow_constructible_v<std::decay_t<RFP>, RFP>, int> = 0>
+        void push(RFP&& rollbackFunction)
+        {
+            auto onFailure = [&rollbackFunction]
+            {
+                rollbackFunction();
+            };
+            detail::scope_guard_base<decltype(onFailure), detail::construction_strategy> guard{std::move(onFailure)};
+
+            actions.template push<std::decay_t<RFP>>(std::forward<RFP>(rollbackFunction));
+            guard.release();
+        }
+
+        savepoint_type savepoint() const noexcept
+        {
+            return actions.mark();
+        }
+
+        void rollback_to(savepoint_type sp)
+        {
+            actions.run_to(sp);
+        }
+
+        void rollback()
+        {
+            actions.run_to(0);
+        }
+
+        void commit() noexcept
+        {
+            actions.clear();
+        }
+
+        std::size_t size() const noexcept
+        {
+            return actions.size();
+        }
+
+        bool empty() const noexcept
+        {
+            return actions.empty();
+        }
+
+
+        undo_log& operator=(const undo_log&) = delete;
+
+
+    private:
+        Actions actions;
+    };
+
+}
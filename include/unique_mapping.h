@@ -0,0 +1,289 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "posix.h"
+#include "unique_resource.h"
+#include <cstddef>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/types.h>
+
+namespace sr::posix
+{
+    enum class advice
+    {
+        normal,
+        sequential,
+        random,
+        willneed,
+        dontneed,
+        hugepage
+    };
+
+
+    struct mapped_region
+    {
+        void* address;
+        std::size_t length;
+    };
+
+
+    template <class T>
+    class mapping_view
+    {
+    public:
+        constexpr mapping_view(T* pointer, std::size_t length) noexcept
+            : first(pointer),
+              count(length)
+        {
+        }
+
+
+        constexpr T* begin() const noexcept
+        {
+            return first;
+        }
+
+        constexpr T* end() const noexcept
+        {
+            return first + count;
+        }
+
+        constexpr T* data() const noexcept
+        {
+            return first;
+        }
+
+        constexpr std::size_t size() const noexcept
+        {
+            return count;
+        }
+
+        constexpr bool empty() const noexcept
+        {
+            return count == 0;
+        }
+
+        constexpr T& operator[](std::size_t index) const noexcept
+        {
+            return first[index];
+        }
+
+
+    private:
+        T* first;
+        std::size_t count;
+    };
+
+
+    namespace detail
+    {
+        struct region_ownership
+        {
+            static constexpr bool owns(const mapped_region& r) noexcept
+            {
+                return is_valid(r);
+            }
+
+            static constexpr void own(mapped_region&) noexcept
+            {
+            }
+
+            static constexpr void disown(mapped_region& r) noexcept
+            {
+                r = mapped_region{nullptr, 0};
+            }
+
+            template <class D>
+            static void dispose(mapped_region& r, const D& d) noexcept
+            {
+                d(r);
+                r = mapped_region{nullptr, 0};
+            }
+
+            static constexpr bool is_valid(const mapped_region& r) noexcept
+            {
+                return r.address != nullptr;
+            }
+        };
+
+
+        struct unmap_deleter
+        {
+            void operator()(const mapped_region& r) const noexcept
+            {
+                ::munmap(r.address, r.length);
+            }
+        };
+
+
+        inline int to_native(advice a) noexcept
+        {
+            switch (a)
+            {
+                case advice::sequential:
+                    return MADV_SEQUENTIAL;
+                case advice::random:
+                    return MADV_RANDOM;
+                case advice::willneed:
+                    return MADV_WILLNEED;
+                case advice::dontneed:
+                    return MADV_DONTNEED;
+                case advice::hugepage:
+#if defined(MADV_HUGEPAGE)
+                    return MADV_HUGEPAGE;
+#else
+                    return -1;
+#endif
+                default:
+                    return MADV_NORMAL;
+            }
+        }
+    }
+
+
+    class unique_mapping
+    {
+        using resource_type = unique_resource<mapped_region, detail::unmap_deleter, detail::region_ownership>;
+
+    public:
+        unique_mapping() noexcept
+            : mapping(mapped_region{nullptr, 0}, detail::unmap_deleter{})
+        {
+        }
+
+        explicit unique_mapping(mapped_region r) noexcept
+            : mapping(r.address != MAP_FAILED ? r : mapped_region{nullptr, 0}, detail::unmap_deleter{})
+        {
+        }
+
+
+        static unique_mapping map(const unique_fd& fd, std::size_t length, off_t offset = 0, int protection = PROT_READ, int flags = MAP_SHARED) noexcept
+        {
+            return unique_mapping{mapped_region{::mmap(nullptr, length, protection, flags, fd.get(), offset), length}};
+        }
+
+        static unique_mapping map_anonymous(std::size_t length, int protection = PROT_READ | PROT_WRITE) noexcept
+        {
+            return unique_mapping{mapped_region{::mmap(nullptr, length, protection, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0), length}};
+        }
+
+
+        bool advise(advice a) noexcept
+        {
+            return advise(a, 0, size());
+        }
+
+        bool advise(advice a, std::size_t offset, std::size_t length) noexcept
+        {
+            const int native = detail::to_native(a);
+            return (native != -1) && (static_cast<bool>(*this) == true) && (::madvise(static_cast<char*>(mapping.get().address) + offset, length, native) == 0);
+        }
+
+        bool remap(std::size_t length, bool mayMove = true) noexcept
+        {
+#if defined(__linux__)
+            const mapped_region current = mapping.get();
+            void* address = ::mremap(current.address, current.length, length, 0);
+
+            if ((address == MAP_FAILED) && (mayMove == true))
+            {
+                address = ::mremap(current.address, current.length, length, MREMAP_MAYMOVE);
+            }
+
+            if (address != MAP_FAILED)
+            {
+                mapping.release();
+                mapping.reset(mapped_region{address, length});
+                return true;
+            }
+            return false;
+#else
+            static_cast<void>(length);
+            static_cast<void>(mayMove);
+            return false;
+#endif
+        }
+
+        void reset() noexcept
+        {
+            mapping.reset();
+        }
+
+        mapped_region release() noexcept
+        {
+            const mapped_region r = mapping.get();
+            mapping.release();
+            return r;
+        }
+
+        const mapped_region& get() const noexcept
+        {
+            return mapping.get();
+        }
+
+        std::byte* data() noexcept
+        {
+            return static_cast<std::byte*>(mapping.get().address);
+        }
+
+        const std::byte* data() const noexcept
+        {
+            return static_cast<const std::byte*>(mapping.get().address);
+        }
+
+        std::size_t size() const noexcept
+        {
+            return mapping.get().length;
+        }
+
+        mapping_view<std::byte> bytes() noexcept
+        {
+            return mapping_view<std::byte>{data(), size()};
+        }
+
+        mapping_view<const std::byte> bytes() const noexcept
+        {
+            return mapping_view<const std::byte>{data(), size()};
+        }
+
+        std::string_view view() const noexcept
+        {
+            return std::string_view{static_cast<const char*>(mapping.get().address), size()};
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return detail::region_ownership::is_valid(mapping.get());
+        }
+
+
+    private:
+        resource_type mapping;
+    };
+
+
+    static_assert(sizeof(unique_mapping) == sizeof(void*) + sizeof(std::size_t));
+
+}
@@ -23,7 +23,10 @@
 #pragma once
 
 #include "scope_exit.h"
+#include "detail/instrument_hooks.h"
 #include "detail/wrapper.h"
+#include <cstddef>
+#include <tuple>
 #include <utility>
 #include <type_traits>
 
@@ -35,44 +38,155 @@ namespace sr
                   class R = std::conditional_t<std::is_nothrow_constructible_v<T, U>, U&&, U>>
         constexpr R forward_if_nothrow_constructible(U&& arg)
         {
+            diagnose_copy_fallback<(std::is_lvalue_reference_v<U> || std::is_nothrow_constructible_v<T, U>)>();
             return std::forward<U>(arg);
         }
+
+
+        struct ResourceTag
+        {
+        };
+
+        struct DeleterTag
+        {
+        };
+
+
+        struct ownership_flag
+        {
+            template <class R>
+            constexpr bool owns(const R&) const noexcept
+            {
+                return execute_on_reset;
+            }
+
+            template <class R>
+            constexpr void own(R&) noexcept
+            {
+                execute_on_reset = true;
+            }
+
+            template <class R>
+            constexpr void disown(R&) noexcept
+            {
+                execute_on_reset = false;
+            }
+
+            template <class R, class D>
+            void dispose(R& r, const D& d) noexcept
+            {
+                execute_on_reset = false;
+                d(r);
+            }
+
+            template <class R>
+            static constexpr bool is_valid(const R&) noexcept
+            {
+                return true;
+            }
+
+
+            bool execute_on_reset{false};
+        };
+
+
+        struct unique_resource_access;
     }
 
 
-    template <class R, class D>
-    class unique_resource
+    template <auto Invalid>
+    struct sentinel
     {
+        static constexpr auto value = Invalid;
+
+
+        template <class R>
+        static constexpr bool owns(const R& r) noexcept
+        {
+            return is_valid(r);
+        }
+
+        template <class R>
+        static constexpr void own(R&) noexcept
+        {
+        }
+
+        template <class R>
+        static constexpr void disown(R& r) noexcept
+        {
+            r = Invalid;
+        }
+
+        template <class R, class D>
+        static void dispose(R& r, const D& d) noexcept
+        {
+            d(r);
+            r = Invalid;
+        }
+
+        template <class R>
+        static constexpr bool is_valid(const R& r) noexcept
+        {
+            return bool(r != Invalid);
+        }
+    };
+
+
+    template <class R, class D, class Ownership = detail::ownership_flag>
+    class unique_resource : private detail::Wrapper<R, detail::ResourceTag>, private detail::Wrapper<D, detail::DeleterTag>, private Ownership
+    {
+        using ResourceWrapper = detail::Wrapper<R, detail::ResourceTag>;
+        using DeleterWrapper = detail::Wrapper<D, detail::DeleterTag>;
+
     public:
         unique_resource()
-            : resource(R{}),
-              deleter(D{}),
-              execute_on_reset(false)
+            : ResourceWrapper(R{}),
+              DeleterWrapper(D{}),
+              Ownership()
         {
+            Ownership::disown(resource().get());
         }
 
         template <class RR, class DD,
                   std::enable_if_t<(std::is_constructible_v<R, RR> && std::is_constructible_v<D, DD> && (std::is_nothrow_constructible_v<R, RR> || std::is_constructible_v<R, RR&>) && (std::is_nothrow_constructible_v<D, DD> || std::is_constructible_v<D, DD&>) ), int> = 0>
         unique_resource(RR&& r, DD&& d) noexcept((std::is_nothrow_constructible_v<R, RR> || std::is_nothrow_constructible_v<R, RR&>) && (std::is_nothrow_constructible_v<D, DD> || std::is_nothrow_constructible_v<D, DD&>) )
-            : resource(detail::forward_if_nothrow_constructible<R, RR>(std::forward<RR>(r)), scope_exit{[&r, &d]
-                                                                                                        { d(r); }}),
-              deleter(detail::forward_if_nothrow_constructible<D, DD>(std::forward<DD>(d)), scope_exit{[this, &d]
-                                                                                                       { d(get()); }}),
-              execute_on_reset(true)
+            : ResourceWrapper(detail::forward_if_nothrow_constructible<R, RR>(std::forward<RR>(r)), detail::make_construction_guard([&r, &d]
+                                                                                                        {
+                                                                                                            if (Ownership::is_valid(r) == true)
+                                                                                                            {
+                                                                                                                d(r);
+                                                                                                            } })),
+              DeleterWrapper(detail::forward_if_nothrow_constructible<D, DD>(std::forward<DD>(d)), detail::make_construction_guard([this, &d]
+                                                                                                       {
+                                                                                                           if (Ownership::is_valid(get()) == true)
+                                                                                                           {
+                                                                                                               d(get());
+                                                                                                           } })),
+              Ownership()
+        {
+            Ownership::own(resource().get());
+            SCOPEGUARD_INSTRUMENT_EVENT(D, construct);
+        }
+
+        template <class... RArgs, class... DArgs,
+                  std::enable_if_t<(std::is_constructible_v<R, RArgs...> && std::is_constructible_v<D, DArgs...>), int> = 0>
+        unique_resource(std::piecewise_construct_t, std::tuple<RArgs...> resourceArgs, std::tuple<DArgs...> deleterArgs) noexcept(std::is_nothrow_constructible_v<R, RArgs...>)
+            : unique_resource(std::move(resourceArgs), std::move(deleterArgs), std::index_sequence_for<RArgs...>{}, std::index_sequence_for<DArgs...>{})
         {
         }
 
         unique_resource(unique_resource&& other) noexcept(std::is_nothrow_move_constructible_v<R> && std::is_nothrow_move_constructible_v<D>)
-            : resource(std::move_if_noexcept(other.resource.get())),
-              deleter(std::move_if_noexcept(other.deleter.get()), scope_exit{[&other]
+            : ResourceWrapper(detail::forward_if_nothrow_move_constructible<R>(other.resource().get())),
+              DeleterWrapper(detail::forward_if_nothrow_move_constructible<D>(other.deleter().get()), detail::make_construction_guard([&other]
                                                                              {
-                                                                                                            if( other.execute_on_reset == true )
+                                                                                                            if( other.owns() == true )
                                                                                                             {
-                                                                                                                other.get_deleter()(other.resource.get());
+                                                                                                                other.get_deleter()(other.resource().get());
                                                                                                             }
-                                                                                                            other.release(); }}),
-              execute_on_reset(std::exchange(other.execute_on_reset, false))
+                                                                                                            other.disown(); })),
+              Ownership(other)
         {
+            other.disown();
         }
 
         unique_resource(const unique_resource&) = delete;
@@ -85,10 +199,10 @@ namespace sr
 
         void reset() noexcept
         {
-            if (execute_on_reset == true)
+            if (owns() == true)
             {
-                execute_on_reset = false;
-                get_deleter()(resource.get());
+                SCOPEGUARD_INSTRUMENT_EXECUTE(D, false);
+                Ownership::dispose(resource().get(), get_deleter());
             }
         }
 
@@ -98,36 +212,42 @@ namespace sr
             reset();
 
             using R1 = typename detail::Wrapper<R>::type;
-            auto se = scope_exit{[this, &r]
-                                 { get_deleter()(r); }};
+            auto se = detail::make_construction_guard([this, &r]
+                                 {
+                                     if (Ownership::is_valid(r) == true)
+                                     {
+                                         get_deleter()(r);
+                                     } });
 
             if constexpr (std::is_nothrow_assignable_v<R1&, RR> == true)
             {
-                resource.reset(std::forward<RR>(r));
+                resource().reset(std::forward<RR>(r));
             }
             else
             {
-                resource.reset(std::as_const(r));
+                resource().reset(std::as_const(r));
             }
 
-            execute_on_reset = true;
+            Ownership::own(resource().get());
             se.release();
+            SCOPEGUARD_INSTRUMENT_EVENT(D, construct);
         }
 
         void release() noexcept
         {
-            execute_on_reset = false;
+            SCOPEGUARD_INSTRUMENT_EVENT(D, release);
+            disown();
         }
 
         const R& get() const noexcept
         {
-            return resource.get();
+            return resource().get();
         }
 
         template <class RR = R, std::enable_if_t<std::is_pointer_v<RR>, int> = 0>
         RR operator->() const noexcept
         {
-            return resource.get();
+            return resource().get();
         }
 
         template <class RR = R,
@@ -139,7 +259,7 @@ namespace sr
 
         const D& get_deleter() const noexcept
         {
-            return deleter.get();
+            return deleter().get();
         }
 
 
@@ -147,6 +267,9 @@ namespace sr
                   std::enable_if_t<(std::is_nothrow_move_assignable_v<RR> || std::is_copy_assignable_v<RR>) && (std::is_nothrow_move_assignable_v<DD> || std::is_copy_assignable_v<DD>), int> = 0>
         unique_resource& operator=(unique_resource&& other) noexcept(std::is_nothrow_assignable_v<R&, R> && std::is_nothrow_assignable_v<D&, D>)
         {
+            detail::diagnose_copy_fallback<std::is_nothrow_move_assignable_v<RR>>();
+            detail::diagnose_copy_fallback<std::is_nothrow_move_assignable_v<DD>>();
+
             if (this != &other)
             {
                 reset();
@@ -155,30 +278,31 @@ namespace sr
                 {
                     if constexpr (std::is_nothrow_move_assignable_v<DD> == true)
                     {
-                        resource.reset(std::move(other.resource));
-                        deleter.reset(std::move(other.deleter));
+                        resource().reset(std::move(other.resource()));
+                        deleter().reset(std::move(other.deleter()));
                     }
                     else
                     {
-                        deleter.reset(other.deleter);
-                        resource.reset(std::move(other.resource));
+                        deleter().reset(other.deleter());
+                        resource().reset(std::move(other.resource()));
                     }
                 }
                 else
                 {
                     if constexpr (std::is_nothrow_move_assignable_v<DD> == true)
                     {
-                        resource.reset(other.resource);
-                        deleter.reset(std::move(other.deleter));
+                        resource().reset(other.resource());
+                        deleter().reset(std::move(other.deleter()));
                     }
                     else
                     {
-                        resource.reset(other.resource);
-                        deleter.reset(other.deleter);
+                        resource().reset(other.resource());
+                        deleter().reset(other.deleter());
                     }
                 }
 
-                execute_on_reset = std::exchange(other.execute_on_reset, false);
+                static_cast<Ownership&>(*this) = static_cast<const Ownership&>(other);
+                other.disown();
             }
             return *this;
         }
@@ -187,12 +311,77 @@ namespace sr
 
 
     private:
-        detail::Wrapper<R> resource;
-        detail::Wrapper<D> deleter;
-        bool execute_on_reset;
+        template <class RTuple, class DTuple, std::size_t... RIs, std::size_t... DIs>
+        unique_resource(RTuple&& resourceArgs, DTuple&& deleterArgs, std::index_sequence<RIs...>, std::index_sequence<DIs...>) noexcept(std::is_nothrow_constructible_v<R, std::tuple_element_t<RIs, RTuple>...>)
+            : ResourceWrapper(std::in_place, std::get<RIs>(std::move(resourceArgs))...),
+              DeleterWrapper(std::in_place, std::get<DIs>(std::move(deleterArgs))...),
+              Ownership()
+        {
+            static_assert(std::is_nothrow_constructible_v<D, std::tuple_element_t<DIs, DTuple>...>, "Deleter constructed in place must not throw");
+            Ownership::own(resource().get());
+            SCOPEGUARD_INSTRUMENT_EVENT(D, construct);
+        }
+
+        void disown() noexcept
+        {
+            Ownership::disown(resource().get());
+        }
+
+        ResourceWrapper& resource() noexcept
+        {
+            return *this;
+        }
+
+        const ResourceWrapper& resource() const noexcept
+        {
+            return *this;
+        }
+
+        DeleterWrapper& deleter() noexcept
+        {
+            return *this;
+        }
+
+        const DeleterWrapper& deleter() const noexcept
+        {
+            return *this;
+        }
+
+        bool owns() const noexcept
+        {
+            return Ownership::owns(resource().get());
+        }
+
+
+        friend struct detail::unique_resource_access;
     };
 
 
+    namespace detail
+    {
+        struct unique_resource_access
+        {
+            template <class R, class D, class Ownership>
+            static R& resource(unique_resource<R, D, Ownership>& r) noexcept
+            {
+                return r.resource().get();
+            }
+
+            template <class R, class D, class Ownership>
+            static D& deleter(unique_resource<R, D, Ownership>& r) noexcept
+            {
+                return r.deleter().get();
+            }
+
+            template <class R, class D, class Ownership>
+            static bool owns(const unique_resource<R, D, Ownership>& r) noexcept
+            {
+                return r.owns();
+            }
+        };
+    }
+
+
     template <class R, class D>
     unique_resource(R, D) -> unique_resource<R, D>;
 
@@ -210,4 +399,10 @@ namespace sr
         return ur;
     }
 
+    template <auto Invalid, class R, class D>
+    unique_resource<std::decay_t<R>, std::decay_t<D>, sentinel<Invalid>> make_unique_resource_checked(R&& r, D&& d) noexcept(std::is_nothrow_constructible_v<std::decay_t<R>, R> && std::is_nothrow_constructible_v<std::decay_t<D>, D>)
+    {
+        return unique_resource<std::decay_t<R>, std::decay_t<D>, sentinel<Invalid>>{std::forward<R>(r), std::forward<D>(d)};
+    }
+
 }
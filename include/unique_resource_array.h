@@ -0,0 +1,440 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "scope_exit.h"
+#include "detail/wrapper.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sr
+{
+    namespace detail
+    {
+        inline int countr_zero(std::uint64_t word) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_ctzll(word);
+#else
+            int count = 0;
+
+            while ((word & 1u) == 0)
+            {
+                word >>= 1;
+                ++count;
+            }
+            return count;
+#endif
+        }
+
+        inline int popcount(std::uint64_t word) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_popcountll(word);
+#else
+            int count = 0;
+
+            for (; word != 0; word &= word - 1)
+            {
+                ++count;
+            }
+            return count;
+#endif
+        }
+    }
+
+
+    template <class R, class D>
+    class unique_resource_array : private detail::Wrapper<D>
+    {
+        using DeleterWrapper = detail::Wrapper<D>;
+        using Word = std::uint64_t;
+        static constexpr std::size_t wordBits = 64;
+
+    public:
+        class live_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = R;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const R*;
+            using reference = const R&;
+
+
+            live_iterator() noexcept
+                : owner(nullptr),
+                  position(0)
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                return owner->handles[position];
+            }
+
+            pointer operator->() const noexcept
+            {
+                return &owner->handles[position];
+            }
+
+            live_iterator& operator++() noexcept
+            {
+                position = owner->next_live(position + 1);
+                return *this;
+            }
+
+            live_iterator operator++(int) noexcept
+            {
+                auto previous = *this;
+                ++*this;
+                return previous;
+            }
+
+            std::size_t index() const noexcept
+            {
+                return position;
+            }
+
+            bool operator==(const live_iterator& other) const noexcept
+            {
+                return position == other.position;
+            }
+
+            bool operator!=(const live_iterator& other) const noexcept
+            {
+                return position != other.position;
+            }
+
+
+        private:
+            live_iterator(const unique_resource_array* array, std::size_t index) noexcept
+                : owner(array),
+                  position(index)
+            {
+            }
+
+
+            const unique_resource_array* owner;
+            std::size_t position;
+
+            friend class unique_resource_array;
+        };
+
+
+        class live_range
+        {
+        public:
+            live_iterator begin() const noexcept
+            {
+                return {owner, owner->next_live(0)};
+            }
+
+            live_iterator end() const noexcept
+            {
+                return {owner, owner->handles.size()};
+            }
+
+
+        private:
+            explicit live_range(const unique_resource_array* array) noexcept
+                : owner(array)
+            {
+            }
+
+
+            const unique_resource_array* owner;
+
+            friend class unique_resource_array;
+        };
+
+
+        unique_resource_array()
+            : DeleterWrapper(D{})
+        {
+        }
+
+        template <class DD, std::enable_if_t<!std::is_same_v<std::decay_t<DD>, unique_resource_array> && std::is_constructible_v<D, DD>, int> = 0>
+        explicit unique_resource_array(DD&& d) noexcept(std::is_nothrow_constructible_v<D, DD>)
+            : DeleterWrapper(std::forward<DD>(d))
+        {
+        }
+
+        unique_resource_array(unique_resource_array&& other) noexcept(std::is_nothrow_move_constructible_v<D>)
+            : DeleterWrapper(std::move_if_noexcept(other.deleter().get())),
+              handles(std::move(other.handles)),
+              live(std::move(other.live)),
+              freeHint(std::exchange(other.freeHint, 0))
+        {
+            other.handles.clear();
+            other.live.clear();
+        }
+
+        unique_resource_array(const unique_resource_array&) = delete;
+
+        ~unique_resource_array()
+        {
+            reset_all();
+        }
+
+
+        template <class RR, std::enable_if_t<std::is_constructible_v<R, RR>, int> = 0>
+        std::size_t emplace(RR&& r)
+        {
+            auto guard = detail::make_construction_guard([this, &r]
+                                    {
+                                        get_deleter()(r);
+                                    });
+
+            const std::size_t index = find_free();
+
+            if (index < handles.size())
+            {
+                assign(index, std::forward<RR>(r));
+            }
+            else
+            {
+                if (live.size() <= (index / wordBits))
+                {
+                    live.push_back(0);
+                }
+                handles.emplace_back(std::forward<RR>(r));
+            }
+            guard.release();
+
+            live[index / wordBits] |= bit(index);
+            return index;
+        }
+
+        void reserve(std::size_t capacity)
+        {
+            handles.reserve(capacity);
+            live.reserve((capacity + wordBits - 1) / wordBits);
+        }
+
+        void release(std::size_t index) noexcept
+        {
+            live[index / wordBits] &= ~bit(index);
+            freeHint = std::min(freeHint, index / wordBits);
+        }
+
+        void reset(std::size_t index) noexcept
+        {
+            if (owns(index) == true)
+            {
+                release(index);
+                get_deleter()(handles[index]);
+            }
+        }
+
+        template <class RR>
+        void reset(std::size_t index, RR&& r)
+        {
+            reset(index);
+
+            auto guard = detail::make_construction_guard([this, &r]
+                                    {
+                                        get_deleter()(r);
+                                    });
+
+            assign(index, std::forward<RR>(r));
+            guard.release();
+            live[index / wordBits] |= bit(index);
+        }
+
+        void reset_all() noexcept
+        {
+            for (std::size_t w = 0; w < live.size(); ++w)
+            {
+                Word word = live[w];
+                live[w] = 0;
+                freeHint = 0;
+
+                while (word != 0)
+                {
+                    get_deleter()(handles[(w * wordBits) + static_cast<std::size_t>(detail::countr_zero(word))]);
+                    word &= word - 1;
+                }
+            }
+        }
+
+        void clear() noexcept
+        {
+            reset_all();
+            handles.clear();
+            live.clear();
+        }
+
+        bool owns(std::size_t index) const noexcept
+        {
+            return (live[index / wordBits] & bit(index)) != 0;
+        }
+
+        const R& get(std::size_t index) const noexcept
+        {
+            return handles[index];
+        }
+
+        const R& operator[](std::size_t index) const noexcept
+        {
+            return handles[index];
+        }
+
+        std::size_t size() const noexcept
+        {
+            return handles.size();
+        }
+
+        bool empty() const noexcept
+        {
+            return handles.empty();
+        }
+
+        const R* data() const noexcept
+        {
+            return handles.data();
+        }
+
+        live_range live_handles() const noexcept
+        {
+            return live_range{this};
+        }
+
+        std::size_t live_size() const noexcept
+        {
+            std::size_t count = 0;
+
+            for (const auto word : live)
+            {
+                count += static_cast<std::size_t>(detail::popcount(word));
+            }
+            return count;
+        }
+
+        const D& get_deleter() const noexcept
+        {
+            return deleter().get();
+        }
+
+
+        unique_resource_array& operator=(unique_resource_array&& other) noexcept(std::is_nothrow_move_assignable_v<D>)
+        {
+            if (this != &other)
+            {
+                clear();
+                deleter().reset(std::move(other.deleter()));
+                handles = std::move(other.handles);
+                live = std::move(other.live);
+                freeHint = std::exchange(other.freeHint, 0);
+                other.handles.clear();
+                other.live.clear();
+            }
+            return *this;
+        }
+
+        unique_resource_array& operator=(const unique_resource_array&) = delete;
+
+
+    private:
+        DeleterWrapper& deleter() noexcept
+        {
+            return *this;
+        }
+
+        const DeleterWrapper& deleter() const noexcept
+        {
+            return *this;
+        }
+
+        static constexpr Word bit(std::size_t index) noexcept
+        {
+            return Word{1} << (index % wordBits);
+        }
+
+        template <class RR>
+        void assign(std::size_t index, RR&& r)
+        {
+            if constexpr (std::is_nothrow_assignable_v<R&, RR> == true)
+            {
+                handles[index] = std::forward<RR>(r);
+            }
+            else
+            {
+                handles[index] = std::as_const(r);
+            }
+        }
+
+        std::size_t find_free() noexcept
+        {
+            for (; freeHint < live.size(); ++freeHint)
+            {
+                const std::size_t first = freeHint * wordBits;
+                Word freeSlots = ~live[freeHint];
+
+                if ((handles.size() - first) < wordBits)
+                {
+                    freeSlots &= (Word{1} << (handles.size() - first)) - 1;
+                }
+
+                if (freeSlots != 0)
+                {
+                    return first + static_cast<std::size_t>(detail::countr_zero(freeSlots));
+                }
+            }
+            return handles.size();
+        }
+
+        std::size_t next_live(std::size_t index) const noexcept
+        {
+            std::size_t w = index / wordBits;
+
+            if (w >= live.size())
+            {
+                return handles.size();
+            }
+
+            Word word = live[w] & (~Word{0} << (index % wordBits));
+
+            while (word == 0)
+            {
+                if (++w == live.size())
+                {
+                    return handles.size();
+                }
+                word = live[w];
+            }
+            return (w * wordBits) + static_cast<std::size_t>(detail::countr_zero(word));
+        }
+
+
+        std::vector<R> handles;
+        std::vector<Word> live;
+        std::size_t freeHint{0};
+    };
+
+}
@@ -0,0 +1,167 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "any_scope_exit.h"
+#include "CallMocks.h"
+#include "AllocationCounter.h"
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <optional>
+#include <vector>
+
+namespace
+{
+    mock::CallMock m;
+
+    void deleter()
+    {
+        m.deleter();
+    }
+}
+
+
+TEST_CASE("exit function called on destruction", "[AnyScopeExit]")
+{
+    REQUIRE_CALL(m, deleter());
+    [[maybe_unused]] sr::any_scope_exit guard{deleter};
+}
+
+TEST_CASE("exit function lambda called on destruction", "[AnyScopeExit]")
+{
+    mock::CallMock cm;
+    REQUIRE_CALL(cm, deleter());
+    [[maybe_unused]] sr::any_scope_exit guard{[&cm]
+                                              { cm.deleter(); }};
+}
+
+TEST_CASE("exit function called and rethrow on copy exception", "[AnyScopeExit]")
+{
+    REQUIRE_THROWS([]
+                   {
+        const mock::ThrowOnCopyMock noMove;
+        REQUIRE_CALL(noMove, deleter());
+
+        sr::any_scope_exit guard{noMove}; }());
+}
+
+TEST_CASE("exit function is not called if released", "[AnyScopeExit]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(0);
+    sr::any_scope_exit guard{deleter};
+    guard.release();
+}
+
+TEST_CASE("default constructed guard does nothing", "[AnyScopeExit]")
+{
+    [[maybe_unused]] const sr::any_scope_exit guard;
+}
+
+TEST_CASE("move transfers state", "[AnyScopeExit]")
+{
+    REQUIRE_CALL(m, deleter());
+    sr::any_scope_exit movedFrom{deleter};
+    [[maybe_unused]] auto guard = std::move(movedFrom);
+}
+
+TEST_CASE("move transfers state if released", "[AnyScopeExit]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(0);
+    sr::any_scope_exit movedFrom{deleter};
+    movedFrom.release();
+    [[maybe_unused]] auto guard = std::move(movedFrom);
+}
+
+TEST_CASE("move assignment calls exit function of assigned-to object", "[AnyScopeExit]")
+{
+    std::vector<int> calls;
+
+    {
+        sr::any_scope_exit guard{[&calls]
+                                 { calls.push_back(1); }};
+        guard = sr::any_scope_exit{[&calls]
+                                   { calls.push_back(2); }};
+        CHECK(calls == std::vector<int>{1});
+    }
+
+    CHECK(calls == std::vector<int>{1, 2});
+}
+
+TEST_CASE("guards can be stored in containers", "[AnyScopeExit]")
+{
+    std::vector<int> calls;
+
+    {
+        std::vector<sr::any_scope_exit<>> guards;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            guards.emplace_back([&calls, i]
+                                { calls.push_back(i); });
+        }
+    }
+
+    CHECK(calls == std::vector<int>{0, 1, 2});
+}
+
+TEST_CASE("guard can be stored in optional", "[AnyScopeExit]")
+{
+    int calls{0};
+    std::optional<sr::any_scope_exit<>> guard{std::in_place, [&calls]
+                                              { ++calls; }};
+    guard.reset();
+    CHECK(calls == 1);
+}
+
+TEST_CASE("small exit function does not allocate", "[AnyScopeExit]")
+{
+    int calls{0};
+    const auto before = mock::allocations;
+
+    {
+        sr::any_scope_exit guard{[&calls, padding = std::array<char, 16>{}]
+                                 { calls += 1 + padding[0]; }};
+        [[maybe_unused]] auto moved = std::move(guard);
+    }
+
+    CHECK(mock::allocations == before);
+    CHECK(calls == 1);
+}
+
+TEST_CASE("large exit function is stored on the heap", "[AnyScopeExit]")
+{
+    int calls{0};
+    const auto before = mock::allocations;
+
+    {
+        sr::any_scope_exit<8> guard{[&calls, padding = std::array<char, 64>{}]
+                                    { calls += 1 + padding[0]; }};
+        [[maybe_unused]] auto moved = std::move(guard);
+    }
+
+    CHECK(mock::allocations == before + 1);
+    CHECK(calls == 1);
+}
+
+TEST_CASE("small buffer size is configurable", "[AnyScopeExit]")
+{
+    STATIC_REQUIRE(sizeof(sr::any_scope_exit<64>) > sizeof(sr::any_scope_exit<8>));
+}
@@ -0,0 +1,120 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "any_unique_resource.h"
+#include "CallMocks.h"
+#include "AllocationCounter.h"
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <vector>
+
+namespace
+{
+    mock::CallMock m;
+
+    void deleter(mock::Handle h)
+    {
+        m.deleter(h);
+    }
+}
+
+
+TEST_CASE("deleter called on destruction", "[AnyUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    [[maybe_unused]] sr::any_unique_resource<mock::Handle> guard{3, deleter};
+}
+
+TEST_CASE("deleter lambda called on destruction", "[AnyUniqueResource]")
+{
+    mock::CallMock cm;
+    REQUIRE_CALL(cm, deleter(3));
+    [[maybe_unused]] sr::any_unique_resource<mock::Handle> guard{3, [&cm](auto h)
+                                                                 { cm.deleter(h); }};
+}
+
+TEST_CASE("deleter not called if released", "[AnyUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3)).TIMES(0);
+    sr::any_unique_resource<mock::Handle> guard{3, deleter};
+    guard.release();
+}
+
+TEST_CASE("default constructed resource does nothing", "[AnyUniqueResource]")
+{
+    [[maybe_unused]] const sr::any_unique_resource<mock::Handle> guard;
+}
+
+TEST_CASE("move transfers state", "[AnyUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    sr::any_unique_resource<mock::Handle> movedFrom{3, deleter};
+    [[maybe_unused]] auto guard = std::move(movedFrom);
+}
+
+TEST_CASE("move assignment calls deleter of assigned-to object", "[AnyUniqueResource]")
+{
+    std::vector<mock::Handle> calls;
+    const auto record = [&calls](auto h)
+    {
+        calls.push_back(h);
+    };
+
+    {
+        sr::any_unique_resource<mock::Handle> guard{3, record};
+        guard = sr::any_unique_resource<mock::Handle>{4, [&calls, padding = std::array<char, 64>{}](auto h)
+                                                      { calls.push_back(h + padding[0]); }};
+        CHECK(calls == std::vector<mock::Handle>{3});
+    }
+
+    CHECK(calls == std::vector<mock::Handle>{3, 4});
+}
+
+TEST_CASE("deleters with different types share one resource type", "[AnyUniqueResource]")
+{
+    std::vector<mock::Handle> calls;
+
+    {
+        std::vector<sr::any_unique_resource<mock::Handle>> resources;
+        resources.emplace_back(1, [&calls](auto h)
+                               { calls.push_back(h); });
+        resources.emplace_back(2, [&calls](auto h)
+                               { calls.push_back(h * 10); });
+    }
+
+    CHECK(calls == std::vector<mock::Handle>{1, 20});
+}
+
+TEST_CASE("small deleter does not allocate", "[AnyUniqueResource]")
+{
+    int calls{0};
+    const auto before = mock::allocations;
+
+    {
+        sr::any_unique_resource<mock::Handle> guard{3, [&calls](auto h)
+                                                    { calls += h; }};
+        [[maybe_unused]] auto moved = std::move(guard);
+    }
+
+    CHECK(mock::allocations == before);
+    CHECK(calls == 3);
+}
@@ -0,0 +1,231 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "atomic_unique_resource.h"
+#include "posix.h"
+#include "CallMocks.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    mock::CallMock m;
+
+    struct Deleter
+    {
+        void operator()(mock::Handle h) const noexcept
+        {
+            m.deleter(h);
+        }
+    };
+
+    using Slot = sr::atomic_unique_resource<mock::Handle, Deleter, -1>;
+}
+
+
+TEST_CASE("default constructed is empty", "[AtomicUniqueResource]")
+{
+    const Slot slot;
+    CHECK(slot.load() == -1);
+}
+
+TEST_CASE("deleter called on destruction", "[AtomicUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    [[maybe_unused]] const Slot slot{sr::make_unique_resource_checked<-1>(3, Deleter{})};
+}
+
+TEST_CASE("construction deduces from unique_resource", "[AtomicUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    auto ur = sr::make_unique_resource_checked<-1>(3, Deleter{});
+    const sr::atomic_unique_resource slot{std::move(ur)};
+    CHECK(ur.get() == -1);
+    CHECK(slot.load() == 3);
+}
+
+TEST_CASE("take transfers ownership", "[AtomicUniqueResource]")
+{
+    Slot slot{sr::make_unique_resource_checked<-1>(3, Deleter{})};
+    {
+        REQUIRE_CALL(m, deleter(3));
+        const auto taken = slot.take();
+        CHECK(taken.get() == 3);
+        CHECK(slot.load() == -1);
+    }
+    const auto empty = slot.take();
+    CHECK(empty.get() == -1);
+}
+
+TEST_CASE("exchange returns previous resource", "[AtomicUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(4));
+    Slot slot{sr::make_unique_resource_checked<-1>(3, Deleter{})};
+    auto desired = sr::make_unique_resource_checked<-1>(4, Deleter{});
+    {
+        REQUIRE_CALL(m, deleter(3));
+        const auto previous = slot.exchange(std::move(desired));
+        CHECK(previous.get() == 3);
+        CHECK(desired.get() == -1);
+        CHECK(slot.load() == 4);
+    }
+}
+
+TEST_CASE("compare_exchange stores on match", "[AtomicUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(4));
+    Slot slot;
+    auto desired = sr::make_unique_resource_checked<-1>(4, Deleter{});
+    mock::Handle expected{-1};
+    CHECK(slot.compare_exchange(expected, desired) == true);
+    CHECK(desired.get() == -1);
+    CHECK(slot.load() == 4);
+}
+
+TEST_CASE("compare_exchange hands over previous resource on match", "[AtomicUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(4));
+    Slot slot{sr::make_unique_resource_checked<-1>(3, Deleter{})};
+    auto desired = sr::make_unique_resource_checked<-1>(4, Deleter{});
+    mock::Handle expected{3};
+    CHECK(slot.compare_exchange(expected, desired) == true);
+    CHECK(desired.get() == 3);
+
+    REQUIRE_CALL(m, deleter(3));
+    desired.reset();
+}
+
+TEST_CASE("compare_exchange leaves desired on mismatch", "[AtomicUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    REQUIRE_CALL(m, deleter(4));
+    Slot slot{sr::make_unique_resource_checked<-1>(3, Deleter{})};
+    auto desired = sr::make_unique_resource_checked<-1>(4, Deleter{});
+    mock::Handle expected{-1};
+    CHECK(slot.compare_exchange(expected, desired) == false);
+    CHECK(expected == 3);
+    CHECK(desired.get() == 4);
+}
+
+TEST_CASE("reset calls deleter", "[AtomicUniqueResource]")
+{
+    Slot slot{sr::make_unique_resource_checked<-1>(3, Deleter{})};
+    {
+        REQUIRE_CALL(m, deleter(3));
+        slot.reset(4);
+    }
+    REQUIRE_CALL(m, deleter(4));
+    slot.reset();
+    CHECK(slot.load() == -1);
+}
+
+TEST_CASE("release does not call deleter", "[AtomicUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3)).TIMES(0);
+    Slot slot{sr::make_unique_resource_checked<-1>(3, Deleter{})};
+    CHECK(slot.release() == 3);
+    CHECK(slot.load() == -1);
+}
+
+TEST_CASE("pointer resource uses null as default invalid value", "[AtomicUniqueResource]")
+{
+    int value{5};
+    int deleted{0};
+    const auto d = [&deleted](int*) noexcept
+    {
+        ++deleted;
+    };
+    using PointerSlot = sr::atomic_unique_resource<int*, std::decay_t<decltype(d)>>;
+    STATIC_REQUIRE(std::is_same_v<PointerSlot::unique_resource_type, decltype(sr::make_unique_resource_checked<nullptr>(&value, d))>);
+    {
+        PointerSlot slot{sr::make_unique_resource_checked<nullptr>(&value, d)};
+        CHECK(slot.load() == &value);
+        CHECK(*slot.take() == 5);
+        CHECK(deleted == 1);
+        CHECK(slot.load() == nullptr);
+    }
+    CHECK(deleted == 1);
+}
+
+TEST_CASE("pointer resource accepts posix handles", "[AtomicUniqueResource]")
+{
+    using FileSlot = sr::atomic_unique_resource<std::FILE*, sr::posix::file_deleter, nullptr>;
+    STATIC_REQUIRE(std::is_same_v<FileSlot::unique_resource_type, sr::posix::unique_FILE>);
+
+    FileSlot slot{sr::posix::fopen("/dev/null", "r")};
+    REQUIRE(slot.load() != nullptr);
+
+    sr::posix::unique_FILE file = slot.take();
+    CHECK(file.get() != nullptr);
+    CHECK(slot.load() == nullptr);
+}
+
+TEST_CASE("handoff between threads deletes each resource once", "[AtomicUniqueResource]")
+{
+    constexpr int count{1000};
+    std::vector<std::atomic<int>> deleted(count);
+    const auto d = [&deleted](int h) noexcept
+    {
+        deleted[static_cast<std::size_t>(h)].fetch_add(1, std::memory_order_relaxed);
+    };
+    {
+        sr::atomic_unique_resource<int, std::decay_t<decltype(d)>, -1> slot{d};
+
+        std::thread producer{[&slot, &d]
+                             {
+                                 for (int i = 0; i < count; ++i)
+                                 {
+                                     auto handle = sr::make_unique_resource_checked<-1>(i, d);
+                                     int expected{-1};
+
+                                     while (slot.compare_exchange(expected, handle) == false)
+                                     {
+                                         expected = -1;
+                                         std::this_thread::yield();
+                                     }
+                                 }
+                             }};
+
+        int received{0};
+
+        while (received < count)
+        {
+            if (const auto handle = slot.take(); handle.get() != -1)
+            {
+                ++received;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+    }
+
+    for (const auto& n : deleted)
+    {
+        CHECK(n.load() == 1);
+    }
+}
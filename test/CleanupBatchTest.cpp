@@ -0,0 +1,207 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "cleanup_batch.h"
+#include "unique_resource.h"
+#include "CallMocks.h"
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+namespace
+{
+    std::vector<std::vector<mock::Handle>> batches;
+    std::vector<mock::Handle> single;
+
+
+    struct BatchDeleter
+    {
+        void operator()(mock::Handle h) const
+        {
+            single.push_back(h);
+        }
+
+        void operator()(sr::resource_span<mock::Handle> handles) const
+        {
+            batches.emplace_back(handles.begin(), handles.end());
+        }
+    };
+
+    struct SingleDeleter
+    {
+        void operator()(mock::Handle h) const
+        {
+            single.push_back(h);
+        }
+    };
+
+    using Resource = sr::unique_resource<mock::Handle, sr::batching<BatchDeleter>>;
+    using Batch = sr::cleanup_batch<mock::Handle, BatchDeleter>;
+
+    void clear()
+    {
+        batches.clear();
+        single.clear();
+    }
+}
+
+
+TEST_CASE("batch deleter protocol is detected", "[CleanupBatch]")
+{
+    STATIC_REQUIRE(sr::is_batch_deleter_v<BatchDeleter, mock::Handle> == true);
+    STATIC_REQUIRE(sr::is_batch_deleter_v<SingleDeleter, mock::Handle> == false);
+}
+
+TEST_CASE("batch is neither copyable nor movable", "[CleanupBatch]")
+{
+    STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<Batch>);
+    STATIC_REQUIRE_FALSE(std::is_move_constructible_v<Batch>);
+    STATIC_REQUIRE_FALSE(std::is_copy_assignable_v<Batch>);
+    STATIC_REQUIRE_FALSE(std::is_move_assignable_v<Batch>);
+}
+
+TEST_CASE("push and flush are noexcept if deleter is", "[CleanupBatch]")
+{
+    struct NothrowDeleter
+    {
+        void operator()(mock::Handle) const noexcept
+        {
+        }
+    };
+
+    STATIC_REQUIRE_FALSE(noexcept(std::declval<Batch&>().flush()));
+    STATIC_REQUIRE_FALSE(noexcept(std::declval<Batch&>().push(std::declval<const mock::Handle&>())));
+    using NothrowBatch = sr::cleanup_batch<mock::Handle, NothrowDeleter>;
+    STATIC_REQUIRE(noexcept(std::declval<NothrowBatch&>().flush()));
+    STATIC_REQUIRE(noexcept(std::declval<NothrowBatch&>().push(std::declval<const mock::Handle&>())));
+}
+
+TEST_CASE("deleter called directly without batch", "[CleanupBatch]")
+{
+    clear();
+
+    {
+        [[maybe_unused]] Resource r{3, sr::batching<BatchDeleter>{}};
+    }
+
+    CHECK(single == std::vector<mock::Handle>{3});
+    CHECK(batches.empty() == true);
+}
+
+TEST_CASE("deleter called once per batch", "[CleanupBatch]")
+{
+    clear();
+
+    {
+        Batch batch;
+        [[maybe_unused]] Resource r1{1, sr::batching<BatchDeleter>{}};
+        [[maybe_unused]] Resource r2{2, sr::batching<BatchDeleter>{}};
+        [[maybe_unused]] Resource r3{3, sr::batching<BatchDeleter>{}};
+    }
+
+    CHECK(single.empty() == true);
+    REQUIRE(batches.size() == 1);
+    CHECK(batches[0] == std::vector<mock::Handle>{3, 2, 1});
+}
+
+TEST_CASE("reset queues handle in batch", "[CleanupBatch]")
+{
+    clear();
+
+    {
+        Batch batch;
+        Resource r{1, sr::batching<BatchDeleter>{}};
+        r.reset(2);
+        r.reset();
+        CHECK(batch.size() == 2);
+    }
+
+    REQUIRE(batches.size() == 1);
+    CHECK(batches[0] == std::vector<mock::Handle>{1, 2});
+}
+
+TEST_CASE("released resource is not queued", "[CleanupBatch]")
+{
+    clear();
+
+    {
+        Batch batch;
+        Resource r{1, sr::batching<BatchDeleter>{}};
+        r.release();
+    }
+
+    CHECK(batches.empty() == true);
+}
+
+TEST_CASE("full batch is flushed", "[CleanupBatch]")
+{
+    clear();
+
+    {
+        Batch batch{2};
+
+        for (mock::Handle h = 0; h < 5; ++h)
+        {
+            [[maybe_unused]] Resource r{h, sr::batching<BatchDeleter>{}};
+        }
+    }
+
+    REQUIRE(batches.size() == 3);
+    CHECK(batches[0] == std::vector<mock::Handle>{0, 1});
+    CHECK(batches[1] == std::vector<mock::Handle>{2, 3});
+    CHECK(batches[2] == std::vector<mock::Handle>{4});
+}
+
+TEST_CASE("nested batch restores outer batch", "[CleanupBatch]")
+{
+    clear();
+
+    {
+        Batch outer;
+        [[maybe_unused]] Resource r1{1, sr::batching<BatchDeleter>{}};
+
+        {
+            Batch inner;
+            [[maybe_unused]] Resource r2{2, sr::batching<BatchDeleter>{}};
+        }
+
+        CHECK(Batch::current() == &outer);
+    }
+
+    CHECK(Batch::current() == nullptr);
+    REQUIRE(batches.size() == 2);
+    CHECK(batches[0] == std::vector<mock::Handle>{2});
+    CHECK(batches[1] == std::vector<mock::Handle>{1});
+}
+
+TEST_CASE("deleter without batch support called per handle on flush", "[CleanupBatch]")
+{
+    clear();
+
+    {
+        sr::cleanup_batch<mock::Handle, SingleDeleter> batch;
+        [[maybe_unused]] sr::unique_resource r1{1, sr::batching<SingleDeleter>{}};
+        [[maybe_unused]] sr::unique_resource r2{2, sr::batching<SingleDeleter>{}};
+        CHECK(single.empty() == true);
+    }
+
+    CHECK(single == std::vector<mock::Handle>{2, 1});
+}
@@ -0,0 +1,117 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "cold.h"
+#include "scope_exit.h"
+#include "scope_fail.h"
+#include "scope_success.h"
+#include "unique_resource.h"
+#include "CallMocks.h"
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+
+namespace
+{
+    mock::CallMock m;
+
+    void deleter(mock::Handle h)
+    {
+        m.deleter(h);
+    }
+}
+
+
+TEST_CASE("cold forwards call", "[Cold]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    const sr::cold d{deleter};
+    d(3);
+}
+
+TEST_CASE("cold calls mutable function", "[Cold]")
+{
+    int calls{0};
+    sr::cold f{[&calls, count = 0]() mutable
+               { calls = ++count; }};
+    f();
+    f();
+    CHECK(calls == 2);
+}
+
+TEST_CASE("cold preserves noexcept", "[Cold]")
+{
+    const auto nothrow = []() noexcept {};
+    const auto mayThrow = [] {};
+    STATIC_REQUIRE(std::is_nothrow_invocable_v<sr::cold<decltype(nothrow)>>);
+    STATIC_REQUIRE_FALSE(std::is_nothrow_invocable_v<sr::cold<decltype(mayThrow)>>);
+}
+
+TEST_CASE("scope_exit with cold exit function", "[Cold]")
+{
+    int calls{0};
+    {
+        [[maybe_unused]] sr::scope_exit guard{sr::cold{[&calls]() noexcept
+                                                       { ++calls; }}};
+    }
+    CHECK(calls == 1);
+}
+
+TEST_CASE("scope_fail with cold exit function called on exception", "[Cold]")
+{
+    int calls{0};
+    try
+    {
+        [[maybe_unused]] sr::scope_fail guard{sr::cold{[&calls]() noexcept
+                                                       { ++calls; }}};
+        throw std::runtime_error{"failure"};
+    }
+    catch (...)
+    {
+    }
+    CHECK(calls == 1);
+}
+
+TEST_CASE("scope_fail with cold exit function not called without exception", "[Cold]")
+{
+    int calls{0};
+    {
+        [[maybe_unused]] sr::scope_fail guard{sr::cold{[&calls]() noexcept
+                                                       { ++calls; }}};
+    }
+    CHECK(calls == 0);
+}
+
+TEST_CASE("scope_success with cold exit function", "[Cold]")
+{
+    int calls{0};
+    {
+        [[maybe_unused]] sr::scope_success guard{sr::cold{[&calls]() noexcept
+                                                          { ++calls; }}};
+    }
+    CHECK(calls == 1);
+}
+
+TEST_CASE("unique_resource with cold deleter", "[Cold]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    [[maybe_unused]] sr::unique_resource guard{mock::Handle{3}, sr::cold{deleter}};
+}
@@ -0,0 +1,55 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Takes the copy fallback on purpose; compiling this with
+// SCOPEGUARD_DIAGNOSE_COPY_FALLBACK defined is expected to fail.
+
+#include "unique_resource.h"
+#include <utility>
+
+namespace
+{
+    struct ThrowingMoveDeleter
+    {
+        ThrowingMoveDeleter() = default;
+
+        ThrowingMoveDeleter(const ThrowingMoveDeleter&) = default;
+
+        ThrowingMoveDeleter(ThrowingMoveDeleter&&) noexcept(false)
+        {
+        }
+
+        ThrowingMoveDeleter& operator=(const ThrowingMoveDeleter&) = default;
+
+        void operator()(int) const noexcept
+        {
+        }
+    };
+}
+
+
+void copyFallback()
+{
+    const ThrowingMoveDeleter d;
+    auto guard = sr::unique_resource{3, d};
+    [[maybe_unused]] auto moved = std::move(guard);
+}
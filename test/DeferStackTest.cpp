@@ -0,0 +1,202 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "defer_stack.h"
+#include "CallMocks.h"
+#include "AllocationCounter.h"
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    mock::CallMock m;
+
+    void deleter()
+    {
+        m.deleter();
+    }
+}
+
+
+TEST_CASE("exit functions called on destruction", "[DeferStack]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(2);
+    sr::defer_stack stack;
+    stack.push(deleter);
+    stack.push(deleter);
+}
+
+TEST_CASE("empty stack does nothing", "[DeferStack]")
+{
+    const sr::defer_stack stack;
+    CHECK(stack.empty() == true);
+    CHECK(stack.size() == 0);
+}
+
+TEST_CASE("exit functions called in reverse order", "[DeferStack]")
+{
+    std::vector<int> calls;
+
+    {
+        sr::defer_stack stack;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            stack.push([&calls, i]
+                       { calls.push_back(i); });
+        }
+        CHECK(stack.size() == 3);
+    }
+
+    CHECK(calls == std::vector<int>{2, 1, 0});
+}
+
+TEST_CASE("exit functions not called if released", "[DeferStack]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(0);
+    sr::defer_stack stack;
+    stack.push(deleter);
+    stack.push(deleter);
+    stack.release();
+    CHECK(stack.empty() == true);
+}
+
+TEST_CASE("stack can be reused after release", "[DeferStack]")
+{
+    REQUIRE_CALL(m, deleter());
+    sr::defer_stack stack;
+    stack.push([] {});
+    stack.release();
+    stack.push(deleter);
+}
+
+TEST_CASE("exit function called and rethrow on copy exception", "[DeferStack]")
+{
+    REQUIRE_THROWS([]
+                   {
+        const mock::ThrowOnCopyMock noMove;
+        REQUIRE_CALL(noMove, deleter());
+
+        sr::defer_stack stack;
+        stack.push(noMove); }());
+}
+
+TEST_CASE("exit functions destroyed once", "[DeferStack]")
+{
+    auto shared = std::make_shared<int>(0);
+
+    {
+        sr::defer_stack stack;
+        stack.push([shared]
+                   { ++*shared; });
+        stack.push([shared] {});
+        stack.release();
+        stack.push([shared]
+                   { ++*shared; });
+        CHECK(shared.use_count() == 2);
+    }
+
+    CHECK(shared.use_count() == 1);
+    CHECK(*shared == 1);
+}
+
+TEST_CASE("inline storage does not allocate", "[DeferStack]")
+{
+    int calls{0};
+    sr::defer_stack<128> stack;
+    const auto before = mock::allocations;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        stack.push([&calls]
+                   { ++calls; });
+    }
+
+    CHECK(mock::allocations == before);
+}
+
+TEST_CASE("exit functions exceeding inline storage called in reverse order", "[DeferStack]")
+{
+    std::vector<int> calls;
+    calls.reserve(100);
+
+    {
+        sr::defer_stack<32> stack;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            stack.push([&calls, i, padding = std::array<char, 24>{}]
+                       { calls.push_back(i + padding[0]); });
+        }
+        CHECK(stack.size() == 100);
+    }
+
+    REQUIRE(calls.size() == 100);
+    CHECK(calls.front() == 99);
+    CHECK(calls.back() == 0);
+}
+
+TEST_CASE("exit functions exceeding inline storage are released", "[DeferStack]")
+{
+    auto shared = std::make_shared<int>(0);
+
+    {
+        sr::defer_stack<16> stack;
+
+        for (int i = 0; i < 20; ++i)
+        {
+            stack.push([shared]
+                       { ++*shared; });
+        }
+        stack.release();
+        CHECK(shared.use_count() == 1);
+    }
+
+    CHECK(*shared == 0);
+}
+
+TEST_CASE("run propagates exception of exit function", "[DeferStack]")
+{
+    std::vector<int> calls;
+    const auto first = [&calls]
+    {
+        calls.push_back(0);
+    };
+    const auto throwing = []
+    {
+        throw std::runtime_error{"exit function failed"};
+    };
+    sr::detail::callable_stack<64> stack;
+    stack.push<std::decay_t<decltype(first)>>(first);
+    stack.push<std::decay_t<decltype(throwing)>>(throwing);
+
+    REQUIRE_THROWS_AS(stack.run(), std::runtime_error);
+    CHECK(calls.empty());
+    CHECK(stack.size() == 1);
+
+    stack.run();
+    CHECK(calls == std::vector<int>{0});
+}
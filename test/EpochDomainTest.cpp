@@ -0,0 +1,257 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "epoch_domain.h"
+#include "unique_resource.h"
+#include "CallMocks.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    std::vector<mock::Handle> deleted;
+
+    struct Deleter
+    {
+        void operator()(mock::Handle h) const
+        {
+            deleted.push_back(h);
+        }
+    };
+
+    using Resource = sr::unique_resource<mock::Handle, Deleter>;
+
+
+    struct Node
+    {
+        explicit Node(int v)
+            : value(v)
+        {
+        }
+
+        int value;
+        std::atomic<bool> dead{false};
+    };
+
+    std::mutex graveyardMutex;
+    std::vector<std::unique_ptr<Node>> graveyard;
+
+    struct NodeDeleter
+    {
+        void operator()(Node* node) const
+        {
+            node->dead.store(true);
+            const std::lock_guard<std::mutex> lock{graveyardMutex};
+            graveyard.emplace_back(node);
+        }
+    };
+}
+
+
+TEST_CASE("retired resource reclaimed without readers", "[EpochDomain]")
+{
+    deleted.clear();
+    sr::epoch_domain domain;
+
+    domain.retire(Resource{1, Deleter{}});
+
+    CHECK(domain.retired() == 0);
+    CHECK(deleted == std::vector<mock::Handle>{1});
+}
+
+TEST_CASE("released resource is not deleted", "[EpochDomain]")
+{
+    deleted.clear();
+    sr::epoch_domain domain;
+    Resource r{1, Deleter{}};
+    r.release();
+
+    domain.retire(std::move(r));
+
+    CHECK(deleted.empty() == true);
+}
+
+TEST_CASE("pinned reader delays reclamation", "[EpochDomain]")
+{
+    deleted.clear();
+    sr::epoch_domain domain;
+    auto reader = domain.register_reader();
+
+    {
+        [[maybe_unused]] auto guard = reader.pin();
+        domain.retire(Resource{1, Deleter{}});
+        CHECK(domain.reclaim() == 0);
+        CHECK(deleted.empty() == true);
+    }
+
+    CHECK(domain.reclaim() == 1);
+    CHECK(deleted == std::vector<mock::Handle>{1});
+}
+
+TEST_CASE("reader pinned after retire does not delay reclamation", "[EpochDomain]")
+{
+    deleted.clear();
+    sr::epoch_domain domain;
+    auto early = domain.register_reader();
+    auto late = domain.register_reader();
+
+    auto earlyGuard = std::make_unique<sr::epoch_domain::guard>(early.pin());
+    domain.retire(Resource{1, Deleter{}});
+
+    {
+        [[maybe_unused]] auto lateGuard = late.pin();
+        domain.retire(Resource{2, Deleter{}});
+        earlyGuard.reset();
+        CHECK(domain.reclaim() == 1);
+        CHECK(deleted == std::vector<mock::Handle>{1});
+    }
+
+    domain.reclaim();
+    CHECK(deleted == std::vector<mock::Handle>{1, 2});
+}
+
+TEST_CASE("nested pins keep reader pinned", "[EpochDomain]")
+{
+    deleted.clear();
+    sr::epoch_domain domain;
+    auto reader = domain.register_reader();
+
+    {
+        [[maybe_unused]] auto outer = reader.pin();
+        domain.retire(Resource{1, Deleter{}});
+
+        {
+            [[maybe_unused]] auto inner = reader.pin();
+        }
+
+        CHECK(domain.reclaim() == 0);
+    }
+
+    CHECK(domain.reclaim() == 1);
+}
+
+TEST_CASE("moving reader keeps live guard valid", "[EpochDomain]")
+{
+    deleted.clear();
+    sr::epoch_domain domain;
+    auto reader = std::make_unique<sr::epoch_domain::reader>(domain.register_reader());
+
+    {
+        [[maybe_unused]] auto outer = reader->pin();
+        sr::epoch_domain::reader moved{std::move(*reader)};
+        reader.reset();
+        domain.retire(Resource{1, Deleter{}});
+
+        {
+            [[maybe_unused]] auto inner = moved.pin();
+        }
+
+        CHECK(domain.reclaim() == 0);
+        CHECK(deleted.empty() == true);
+    }
+
+    CHECK(domain.reclaim() == 1);
+    CHECK(deleted == std::vector<mock::Handle>{1});
+}
+
+TEST_CASE("destruction deletes pending resources", "[EpochDomain]")
+{
+    deleted.clear();
+
+    {
+        sr::epoch_domain domain;
+        auto reader = domain.register_reader();
+        [[maybe_unused]] auto guard = reader.pin();
+        domain.retire(Resource{1, Deleter{}});
+        CHECK(deleted.empty() == true);
+    }
+
+    CHECK(deleted == std::vector<mock::Handle>{1});
+}
+
+TEST_CASE("reader slots are limited and reused", "[EpochDomain]")
+{
+    sr::epoch_domain domain{1};
+
+    {
+        [[maybe_unused]] auto reader = domain.register_reader();
+        CHECK_THROWS_AS(domain.register_reader(), std::length_error);
+    }
+
+    CHECK_NOTHROW(domain.register_reader());
+}
+
+TEST_CASE("readers never observe deleted resources", "[EpochDomain]")
+{
+    constexpr int readerCount{4};
+    constexpr int swaps{2000};
+    sr::epoch_domain domain;
+    std::atomic<Node*> current{new Node{0}};
+    sr::unique_resource<Node*, NodeDeleter> owner{current.load(), NodeDeleter{}};
+    std::atomic<bool> running{true};
+    std::atomic<int> violations{0};
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < readerCount; ++i)
+    {
+        readers.emplace_back([&domain, &current, &running, &violations]
+                             {
+            auto reader = domain.register_reader();
+
+            while (running.load() == true)
+            {
+                [[maybe_unused]] auto guard = reader.pin();
+                const Node* node = current.load();
+
+                if (node->dead.load() == true)
+                {
+                    ++violations;
+                }
+            } });
+    }
+
+    for (int i = 1; i <= swaps; ++i)
+    {
+        sr::unique_resource<Node*, NodeDeleter> next{new Node{i}, NodeDeleter{}};
+        current.store(next.get());
+        std::swap(owner, next);
+        domain.retire(std::move(next));
+    }
+
+    running.store(false);
+
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    domain.synchronize();
+
+    CHECK(violations.load() == 0);
+    CHECK(domain.retired() == 0);
+    CHECK(current.load()->value == swaps);
+    owner.reset();
+    graveyard.clear();
+}
@@ -0,0 +1,81 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "function_constant.h"
+#include "scope_exit.h"
+#include "unique_resource.h"
+#include "CallMocks.h"
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+    mock::CallMock m;
+
+    void deleter(mock::Handle h)
+    {
+        m.deleter(h);
+    }
+
+    void exitFunction()
+    {
+        m.deleter();
+    }
+
+    int add(int a, int b) noexcept
+    {
+        return a + b;
+    }
+}
+
+
+TEST_CASE("function constant takes no storage", "[FunctionConstant]")
+{
+    STATIC_REQUIRE(std::is_empty_v<sr::fn_deleter<&deleter>>);
+    STATIC_REQUIRE(sizeof(sr::scope_exit<sr::fn_exit<&exitFunction>>) == sizeof(bool));
+    STATIC_REQUIRE(sizeof(sr::unique_resource<mock::Handle, sr::fn_deleter<&deleter>, sr::sentinel<-1>>) == sizeof(mock::Handle));
+}
+
+TEST_CASE("function constant forwards arguments and result", "[FunctionConstant]")
+{
+    constexpr sr::function_constant<&add> f{};
+    STATIC_REQUIRE(noexcept(f(3, 4)));
+    CHECK(f(3, 4) == 7);
+}
+
+TEST_CASE("exit function constant called on destruction", "[FunctionConstant]")
+{
+    REQUIRE_CALL(m, deleter());
+    [[maybe_unused]] sr::scope_exit guard{sr::fn_exit<&exitFunction>{}};
+}
+
+TEST_CASE("deleter function constant called on destruction", "[FunctionConstant]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    [[maybe_unused]] sr::unique_resource guard{mock::Handle{3}, sr::fn_deleter<&deleter>{}};
+}
+
+TEST_CASE("deleter function constant with default construction", "[FunctionConstant]")
+{
+    REQUIRE_CALL(m, deleter(5));
+    sr::unique_resource<mock::Handle, sr::fn_deleter<&deleter>> guard{};
+    guard.reset(5);
+}
@@ -0,0 +1,166 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "scope_exit.h"
+#include "scope_fail.h"
+#include "scope_success.h"
+#include "unique_resource.h"
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <tuple>
+
+#ifndef SCOPEGUARD_DIAGNOSE_COPY_FALLBACK
+#error "SCOPEGUARD_DIAGNOSE_COPY_FALLBACK expected to be defined for this test"
+#endif
+
+namespace
+{
+    struct PinnedCallable
+    {
+        PinnedCallable(int* counter, int increment) noexcept
+            : calls(counter),
+              value(increment)
+        {
+        }
+
+        PinnedCallable(const PinnedCallable&) = delete;
+        PinnedCallable(PinnedCallable&&) = delete;
+
+        void operator()() const noexcept
+        {
+            *calls += value;
+        }
+
+        PinnedCallable& operator=(const PinnedCallable&) = delete;
+        PinnedCallable& operator=(PinnedCallable&&) = delete;
+
+        int* calls;
+        int value;
+        std::array<char, 256> buffer{};
+    };
+
+
+    struct PinnedResource
+    {
+        PinnedResource(int handle, char fill)
+            : id(handle)
+        {
+            buffer.fill(fill);
+        }
+
+        PinnedResource(const PinnedResource&) = delete;
+        PinnedResource(PinnedResource&&) = delete;
+
+        PinnedResource& operator=(const PinnedResource&) = delete;
+        PinnedResource& operator=(PinnedResource&&) = delete;
+
+        int id;
+        std::array<char, 256> buffer{};
+    };
+
+
+    struct CountingDeleter
+    {
+        explicit CountingDeleter(int* counter) noexcept
+            : deleted(counter)
+        {
+        }
+
+        void operator()(const PinnedResource& r) const noexcept
+        {
+            *deleted += r.id;
+        }
+
+        void operator()(int r) const noexcept
+        {
+            *deleted += r;
+        }
+
+        int* deleted;
+    };
+}
+
+
+TEST_CASE("scope_exit constructs exit function in place", "[InPlaceConstruction]")
+{
+    int calls{0};
+    {
+        [[maybe_unused]] sr::scope_exit guard{std::in_place_type<PinnedCallable>, &calls, 3};
+    }
+    CHECK(calls == 3);
+}
+
+TEST_CASE("scope_exit constructed in place can be released", "[InPlaceConstruction]")
+{
+    int calls{0};
+    {
+        sr::scope_exit guard{std::in_place_type<PinnedCallable>, &calls, 3};
+        guard.release();
+    }
+    CHECK(calls == 0);
+}
+
+TEST_CASE("scope_fail and scope_success construct exit function in place", "[InPlaceConstruction]")
+{
+    int calls{0};
+    {
+        [[maybe_unused]] sr::scope_fail fail{std::in_place_type<PinnedCallable>, &calls, 1};
+        [[maybe_unused]] sr::scope_success success{std::in_place_type<PinnedCallable>, &calls, 2};
+    }
+    CHECK(calls == 2);
+}
+
+TEST_CASE("unique_resource constructs resource and deleter in place", "[InPlaceConstruction]")
+{
+    int deleted{0};
+    {
+        const sr::unique_resource<PinnedResource, CountingDeleter> guard{std::piecewise_construct, std::forward_as_tuple(3, 'x'), std::forward_as_tuple(&deleted)};
+        CHECK(guard.get().id == 3);
+        CHECK(guard.get().buffer[255] == 'x');
+    }
+    CHECK(deleted == 3);
+}
+
+TEST_CASE("unique_resource constructed in place respects sentinel", "[InPlaceConstruction]")
+{
+    int deleted{0};
+    {
+        const sr::unique_resource<int, CountingDeleter, sr::sentinel<-1>> guard{std::piecewise_construct, std::make_tuple(-1), std::forward_as_tuple(&deleted)};
+    }
+    CHECK(deleted == 0);
+}
+
+TEST_CASE("nothrow moves compile in diagnostic mode", "[InPlaceConstruction]")
+{
+    int deleted{0};
+    {
+        auto guard = sr::unique_resource{3, CountingDeleter{&deleted}};
+        auto moved = std::move(guard);
+        auto assigned = sr::unique_resource{4, CountingDeleter{&deleted}};
+        assigned = std::move(moved);
+
+        auto exitGuard = sr::scope_exit{[&deleted]() noexcept
+                                        { deleted += 10; }};
+        [[maybe_unused]] auto movedExitGuard = std::move(exitGuard);
+    }
+    CHECK(deleted == 17);
+}
@@ -0,0 +1,280 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "instrument.h"
+#include "scope_exit.h"
+#include "scope_fail.h"
+#include "scope_success.h"
+#include "unique_resource.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct CountingDeleter
+    {
+        void operator()(int) const noexcept
+        {
+        }
+    };
+
+    struct OtherDeleter
+    {
+        void operator()(int) const noexcept
+        {
+        }
+    };
+
+    struct GuardOnDestruction
+    {
+        ~GuardOnDestruction()
+        {
+            [[maybe_unused]] sr::scope_exit guard{[] {}};
+        }
+    };
+
+
+    sr::instrument_counters find(const std::vector<sr::instrument_entry>& entries, const char* name)
+    {
+        for (const auto& entry : entries)
+        {
+            if (std::strcmp(entry.name, name) == 0)
+            {
+                return entry.counters;
+            }
+        }
+        return sr::instrument_counters{0, 0, 0, 0};
+    }
+
+    sr::instrument_counters delta(const char* name, const std::vector<sr::instrument_entry>& before)
+    {
+        const auto now = find(sr::instrument_thread_snapshot(), name);
+        const auto old = find(before, name);
+        return sr::instrument_counters{now.construct - old.construct, now.execute - old.execute,
+                                       now.release - old.release, now.fail - old.fail};
+    }
+}
+
+
+TEST_CASE("scope_exit construction and execution are counted", "[Instrument]")
+{
+    const auto before = sr::instrument_thread_snapshot();
+    {
+        [[maybe_unused]] sr::scope_exit guard{[] {}};
+    }
+    const auto counters = delta("scope_exit", before);
+    CHECK(counters.construct == 1);
+    CHECK(counters.execute == 1);
+    CHECK(counters.release == 0);
+    CHECK(counters.fail == 0);
+}
+
+TEST_CASE("scope_exit release is counted", "[Instrument]")
+{
+    const auto before = sr::instrument_thread_snapshot();
+    {
+        sr::scope_exit guard{[] {}};
+        guard.release();
+    }
+    const auto counters = delta("scope_exit", before);
+    CHECK(counters.construct == 1);
+    CHECK(counters.execute == 0);
+    CHECK(counters.release == 1);
+}
+
+TEST_CASE("scope_exit move does not count release", "[Instrument]")
+{
+    const auto before = sr::instrument_thread_snapshot();
+    {
+        sr::scope_exit guard{[] {}};
+        [[maybe_unused]] sr::scope_exit moved{std::move(guard)};
+    }
+    const auto counters = delta("scope_exit", before);
+    CHECK(counters.execute == 1);
+    CHECK(counters.release == 0);
+}
+
+TEST_CASE("scope_fail execution during unwinding is counted as failure", "[Instrument]")
+{
+    const auto before = sr::instrument_thread_snapshot();
+    try
+    {
+        [[maybe_unused]] sr::scope_fail guard{[] {}};
+        throw std::runtime_error{"failure"};
+    }
+    catch (...)
+    {
+    }
+    {
+        [[maybe_unused]] sr::scope_fail guard{[] {}};
+    }
+    const auto counters = delta("scope_fail", before);
+    CHECK(counters.construct == 2);
+    CHECK(counters.execute == 1);
+    CHECK(counters.fail == 1);
+}
+
+TEST_CASE("scope_exit failure counts only exceptions thrown after construction", "[Instrument]")
+{
+    const auto before = sr::instrument_thread_snapshot();
+    try
+    {
+        [[maybe_unused]] GuardOnDestruction unwinding;
+        [[maybe_unused]] sr::scope_exit guard{[] {}};
+        throw std::runtime_error{"failure"};
+    }
+    catch (...)
+    {
+    }
+    const auto counters = delta("scope_exit", before);
+    CHECK(counters.execute == 2);
+    CHECK(counters.fail == 1);
+}
+
+TEST_CASE("scope_success is counted separately", "[Instrument]")
+{
+    const auto before = sr::instrument_thread_snapshot();
+    {
+        [[maybe_unused]] sr::scope_success guard{[] {}};
+    }
+    CHECK(delta("scope_success", before).execute == 1);
+    CHECK(delta("scope_exit", before).construct == 0);
+}
+
+TEST_CASE("unique_resource is counted per deleter", "[Instrument]")
+{
+    const auto before = sr::instrument_thread_snapshot();
+    {
+        [[maybe_unused]] sr::unique_resource first{3, CountingDeleter{}};
+        [[maybe_unused]] sr::unique_resource second{4, CountingDeleter{}};
+        sr::unique_resource third{5, OtherDeleter{}};
+        third.release();
+    }
+    const auto counting = delta(sr::instrument_name<CountingDeleter>, before);
+    CHECK(counting.construct == 2);
+    CHECK(counting.execute == 2);
+    CHECK(counting.release == 0);
+
+    const auto other = delta(sr::instrument_name<OtherDeleter>, before);
+    CHECK(other.construct == 1);
+    CHECK(other.execute == 0);
+    CHECK(other.release == 1);
+}
+
+TEST_CASE("unique_resource move does not count release", "[Instrument]")
+{
+    const auto before = sr::instrument_thread_snapshot();
+    {
+        sr::unique_resource guard{3, CountingDeleter{}};
+        [[maybe_unused]] sr::unique_resource moved{std::move(guard)};
+    }
+    const auto counters = delta(sr::instrument_name<CountingDeleter>, before);
+    CHECK(counters.execute == 1);
+    CHECK(counters.release == 0);
+}
+
+TEST_CASE("unique_resource internal construction guards are not counted", "[Instrument]")
+{
+    const auto before = sr::instrument_thread_snapshot();
+    {
+        [[maybe_unused]] sr::unique_resource guard{3, CountingDeleter{}};
+    }
+    const auto after = sr::instrument_thread_snapshot();
+
+    for (const auto& entry : after)
+    {
+        const auto counters = delta(entry.name, before);
+
+        if (std::strcmp(entry.name, sr::instrument_name<CountingDeleter>) == 0)
+        {
+            CHECK(counters.construct == 1);
+            CHECK(counters.execute == 1);
+            CHECK(counters.release == 0);
+        }
+        else
+        {
+            CHECK(counters.construct == 0);
+            CHECK(counters.release == 0);
+        }
+    }
+}
+
+TEST_CASE("default key name is readable", "[Instrument]")
+{
+    CHECK(std::strstr(sr::instrument_name<CountingDeleter>, "CountingDeleter") != nullptr);
+}
+
+TEST_CASE("snapshot aggregates all threads", "[Instrument]")
+{
+    constexpr std::size_t threadCount{4};
+    constexpr std::size_t iterations{100};
+    const auto before = find(sr::instrument_snapshot(), "scope_success");
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([]
+                             {
+                                 for (std::size_t n = 0; n < iterations; ++n)
+                                 {
+                                     [[maybe_unused]] sr::scope_success guard{[] {}};
+                                 } });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    const auto after = find(sr::instrument_snapshot(), "scope_success");
+    CHECK(after.construct - before.construct == threadCount * iterations);
+    CHECK(after.execute - before.execute == threadCount * iterations);
+}
+
+TEST_CASE("counters of exited threads are kept but not reported to new threads", "[Instrument]")
+{
+    constexpr std::size_t iterations{3};
+    const auto before = find(sr::instrument_snapshot(), "scope_success");
+
+    std::thread{[]
+                {
+                    for (std::size_t n = 0; n < iterations; ++n)
+                    {
+                        [[maybe_unused]] sr::scope_success guard{[] {}};
+                    } }}
+        .join();
+
+    sr::instrument_counters fresh{1, 1, 1, 1};
+    std::thread{[&fresh]
+                { fresh = find(sr::instrument_thread_snapshot(), "scope_success"); }}
+        .join();
+
+    CHECK(fresh.construct == 0);
+    CHECK(fresh.execute == 0);
+
+    const auto after = find(sr::instrument_snapshot(), "scope_success");
+    CHECK(after.construct - before.construct == iterations);
+    CHECK(after.execute - before.execute == iterations);
+}
@@ -0,0 +1,248 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "lazy_unique_resource.h"
+#include "CallMocks.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    mock::CallMock m;
+
+    void deleter(mock::Handle h)
+    {
+        m.deleter(h);
+    }
+
+
+    struct Acquire
+    {
+        mock::Handle operator()() const
+        {
+            ++*calls;
+            return 3;
+        }
+
+        int* calls;
+    };
+}
+
+
+TEST_CASE("construction does not acquire", "[LazyUniqueResource]")
+{
+    int calls{0};
+    const sr::lazy_unique_resource guard{Acquire{&calls}, deleter};
+    CHECK(guard.acquired() == false);
+    CHECK(calls == 0);
+}
+
+TEST_CASE("get acquires once", "[LazyUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    int calls{0};
+    const sr::lazy_unique_resource guard{Acquire{&calls}, deleter};
+    CHECK(guard.get() == 3);
+    CHECK(guard.get() == 3);
+    CHECK(guard.acquired() == true);
+    CHECK(calls == 1);
+}
+
+TEST_CASE("reset calls deleter and allows reacquisition", "[LazyUniqueResource]")
+{
+    int calls{0};
+    sr::lazy_unique_resource guard{Acquire{&calls}, deleter};
+    static_cast<void>(guard.get());
+    {
+        REQUIRE_CALL(m, deleter(3));
+        guard.reset();
+    }
+    CHECK(guard.acquired() == false);
+
+    static_cast<void>(guard.get());
+    CHECK(calls == 2);
+
+    REQUIRE_CALL(m, deleter(3));
+    guard.reset();
+}
+
+TEST_CASE("reset with value replaces resource", "[LazyUniqueResource]")
+{
+    int calls{0};
+    sr::lazy_unique_resource guard{Acquire{&calls}, deleter};
+    guard.reset(7);
+    CHECK(guard.get() == 7);
+    CHECK(calls == 0);
+
+    REQUIRE_CALL(m, deleter(7));
+    guard.reset();
+}
+
+TEST_CASE("release keeps resource but does not call deleter", "[LazyUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3)).TIMES(0);
+    int calls{0};
+    sr::lazy_unique_resource guard{Acquire{&calls}, deleter};
+    static_cast<void>(guard.get());
+    guard.release();
+    CHECK(guard.get() == 3);
+    CHECK(calls == 1);
+}
+
+TEST_CASE("deleter not called if never acquired", "[LazyUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3)).TIMES(0);
+    int calls{0};
+    [[maybe_unused]] const sr::lazy_unique_resource guard{Acquire{&calls}, deleter};
+}
+
+TEST_CASE("failed acquisition is retried", "[LazyUniqueResource]")
+{
+    int attempts{0};
+    const auto acquire = [&attempts]
+    {
+        if (++attempts == 1)
+        {
+            throw std::runtime_error{"failed"};
+        }
+        return 3;
+    };
+    REQUIRE_CALL(m, deleter(3));
+    const sr::lazy_unique_resource guard{acquire, deleter};
+
+    CHECK_THROWS(guard.get());
+    CHECK(guard.acquired() == false);
+    CHECK(guard.get() == 3);
+    CHECK(attempts == 2);
+}
+
+TEST_CASE("pointer access", "[LazyUniqueResource]")
+{
+    std::pair<int, int> value{1, 2};
+    const sr::lazy_unique_resource guard{[&value]
+                                         { return &value; },
+                                         [](auto*) {}};
+    CHECK(guard->second == 2);
+    CHECK((*guard).first == 1);
+}
+
+TEST_CASE("concurrent get acquires once", "[LazyUniqueResource]")
+{
+    std::atomic<int> calls{0};
+    std::atomic<int> deleted{0};
+    {
+        const sr::lazy_unique_resource guard{[&calls]
+                                             {
+                                                 calls.fetch_add(1, std::memory_order_relaxed);
+                                                 std::this_thread::yield();
+                                                 return 3;
+                                             },
+                                             [&deleted](int)
+                                             { deleted.fetch_add(1, std::memory_order_relaxed); }};
+        std::vector<std::thread> threads;
+
+        for (int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([&guard]
+                                 { CHECK(guard.get() == 3); });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    }
+    CHECK(calls.load() == 1);
+    CHECK(deleted.load() == 1);
+}
+
+TEST_CASE("waiting get retries after concurrent acquisition throws", "[LazyUniqueResource]")
+{
+    std::atomic<int> calls{0};
+    std::atomic<bool> proceed{false};
+    const sr::lazy_unique_resource guard{[&calls, &proceed]
+                                         {
+                                             if (calls.fetch_add(1) == 0)
+                                             {
+                                                 while (proceed.load() == false)
+                                                 {
+                                                     std::this_thread::yield();
+                                                 }
+                                                 throw std::runtime_error{"failed"};
+                                             }
+                                             return 3;
+                                         },
+                                         [](int) {}};
+    bool failed{false};
+    int value{0};
+
+    std::thread first{[&guard, &failed]
+                      {
+                          try
+                          {
+                              guard.get();
+                          }
+                          catch (const std::runtime_error&)
+                          {
+                              failed = true;
+                          }
+                      }};
+    while (calls.load() == 0)
+    {
+        std::this_thread::yield();
+    }
+    std::thread second{[&guard, &value]
+                       { value = guard.get(); }};
+    proceed.store(true);
+    first.join();
+    second.join();
+
+    CHECK(failed == true);
+    CHECK(value == 3);
+    CHECK(calls.load() == 2);
+}
+
+TEST_CASE("invalid acquisition result not deleted with sentinel ownership", "[LazyUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(-1)).TIMES(0);
+    const auto acquire = []
+    {
+        return mock::Handle{-1};
+    };
+    sr::lazy_unique_resource<mock::Handle, void (*)(mock::Handle), decltype(acquire), sr::sentinel<-1>> guard{acquire, deleter};
+    CHECK(guard.get() == -1);
+    guard.reset();
+
+    guard.reset(-1);
+    guard.reset();
+}
+
+TEST_CASE("valid acquisition result deleted with sentinel ownership", "[LazyUniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    int calls{0};
+    sr::lazy_unique_resource<mock::Handle, void (*)(mock::Handle), Acquire, sr::sentinel<-1>> guard{Acquire{&calls}, deleter};
+    CHECK(guard.get() == 3);
+    guard.reset();
+}
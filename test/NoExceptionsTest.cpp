@@ -0,0 +1,125 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Built with -fno-exceptions, therefore not using Catch2 / trompeloeil.
+
+#include "scope.h"
+#include "epoch_domain.h"
+#include <cstdio>
+
+#ifndef SCOPEGUARD_NO_EXCEPTIONS
+#error "SCOPEGUARD_NO_EXCEPTIONS not detected"
+#endif
+
+namespace
+{
+    int calls{0};
+    int failures{0};
+
+    void exitFunction()
+    {
+        ++calls;
+    }
+
+    void deleter(int h)
+    {
+        calls += h;
+    }
+
+    void check(bool condition, const char* name)
+    {
+        if (condition == false)
+        {
+            std::fprintf(stderr, "FAILED: %s\n", name);
+            ++failures;
+        }
+    }
+
+    struct ExitFunction
+    {
+        void operator()() const
+        {
+            exitFunction();
+        }
+    };
+}
+
+
+int main()
+{
+    static_assert(sizeof(sr::scope_fail<ExitFunction>) == sizeof(bool));
+    static_assert(sizeof(sr::scope_success<ExitFunction>) == sizeof(bool));
+
+    calls = 0;
+    {
+        [[maybe_unused]] sr::scope_exit guard{exitFunction};
+    }
+    check(calls == 1, "scope_exit calls exit function");
+
+    calls = 0;
+    {
+        const ExitFunction f{};
+        [[maybe_unused]] sr::scope_exit guard{f};
+    }
+    check(calls == 1, "scope_exit constructed from lvalue calls exit function");
+
+    calls = 0;
+    {
+        [[maybe_unused]] sr::scope_fail guard{exitFunction};
+    }
+    check(calls == 0, "scope_fail never calls exit function");
+
+    calls = 0;
+    {
+        [[maybe_unused]] sr::scope_success guard{exitFunction};
+    }
+    check(calls == 1, "scope_success always calls exit function");
+
+    calls = 0;
+    {
+        auto guard = sr::scope_success{exitFunction};
+        guard.release();
+    }
+    check(calls == 0, "scope_success does not call exit function if released");
+
+    calls = 0;
+    {
+        auto movedFrom = sr::unique_resource{3, deleter};
+        [[maybe_unused]] auto guard = std::move(movedFrom);
+    }
+    check(calls == 3, "unique_resource calls deleter once");
+
+    calls = 0;
+    {
+        sr::epoch_domain domain{1};
+        auto reader = domain.register_reader();
+        {
+            [[maybe_unused]] auto pinned = reader.pin();
+            domain.retire(sr::unique_resource{4, deleter});
+            check(calls == 0, "epoch_domain defers deletion while pinned");
+        }
+        domain.reclaim();
+    }
+    check(calls == 4, "epoch_domain deletes retired resource");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,208 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "posix.h"
+#include "unique_resource.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cerrno>
+#include <vector>
+#include <fcntl.h>
+#include <netinet/in.h>
+
+namespace
+{
+    bool isOpen(int fd)
+    {
+        return ::fcntl(fd, F_GETFD) != -1;
+    }
+
+    std::vector<int> openFds(std::size_t count)
+    {
+        std::vector<int> fds;
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            fds.push_back(::open("/dev/null", O_RDONLY));
+        }
+        return fds;
+    }
+}
+
+
+TEST_CASE("fd deleter closes single fd", "[Posix]")
+{
+    const int fd = ::open("/dev/null", O_RDONLY);
+    REQUIRE(isOpen(fd) == true);
+
+    sr::posix::fd_deleter{}(fd);
+    CHECK(isOpen(fd) == false);
+}
+
+TEST_CASE("fd deleter closes ascending and descending runs", "[Posix]")
+{
+    const auto fds = openFds(6);
+    const std::vector<int> order{fds[0], fds[1], fds[2], fds[5], fds[4], fds[3]};
+
+    sr::posix::fd_deleter{}(sr::resource_span<int>{order.data(), order.size()});
+
+    for (int fd : fds)
+    {
+        CHECK(isOpen(fd) == false);
+    }
+}
+
+TEST_CASE("fd deleter closes only fds of span", "[Posix]")
+{
+    const auto fds = openFds(3);
+    const std::vector<int> order{fds[0], fds[2]};
+
+    sr::posix::fd_deleter{}(sr::resource_span<int>{order.data(), order.size()});
+
+    CHECK(isOpen(fds[0]) == false);
+    CHECK(isOpen(fds[1]) == true);
+    CHECK(isOpen(fds[2]) == false);
+    ::close(fds[1]);
+}
+
+TEST_CASE("batched fds closed at end of batch", "[Posix]")
+{
+    const auto fds = openFds(4);
+
+    {
+        sr::cleanup_batch<int, sr::posix::fd_deleter> batch;
+        std::vector<sr::unique_resource<int, sr::batching<sr::posix::fd_deleter>>> resources;
+
+        for (int fd : fds)
+        {
+            resources.emplace_back(fd, sr::batching<sr::posix::fd_deleter>{});
+        }
+        resources.clear();
+
+        CHECK(batch.size() == 4);
+        CHECK(isOpen(fds[0]) == true);
+    }
+
+    for (int fd : fds)
+    {
+        CHECK(isOpen(fd) == false);
+    }
+}
+
+TEST_CASE("handle wrappers have size of raw handle", "[Posix]")
+{
+    STATIC_REQUIRE(sizeof(sr::posix::unique_fd) == sizeof(int));
+    STATIC_REQUIRE(sizeof(sr::posix::unique_socket) == sizeof(int));
+    STATIC_REQUIRE(sizeof(sr::posix::unique_dir) == sizeof(DIR*));
+    STATIC_REQUIRE(sizeof(sr::posix::unique_FILE) == sizeof(std::FILE*));
+}
+
+TEST_CASE("open returns owning fd", "[Posix]")
+{
+    int fd{-1};
+    {
+        const auto file = sr::posix::open("/dev/null", O_RDONLY);
+        fd = file.get();
+        REQUIRE(fd != -1);
+        CHECK(isOpen(fd) == true);
+    }
+    CHECK(isOpen(fd) == false);
+}
+
+TEST_CASE("failed open returns invalid fd and keeps errno", "[Posix]")
+{
+    const auto file = sr::posix::open("/nonexistent/file", O_RDONLY);
+    CHECK(errno == ENOENT);
+    CHECK(file.get() == -1);
+}
+
+TEST_CASE("release of fd leaves it open", "[Posix]")
+{
+    auto file = sr::posix::open("/dev/null", O_RDONLY);
+    const int fd = file.get();
+    file.release();
+    CHECK(file.get() == -1);
+    CHECK(isOpen(fd) == true);
+    ::close(fd);
+}
+
+TEST_CASE("socket and accept return owning sockets", "[Posix]")
+{
+    const auto listener = sr::posix::socket(AF_INET, SOCK_STREAM);
+    REQUIRE(listener.get() != -1);
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    REQUIRE(::bind(listener.get(), reinterpret_cast<sockaddr*>(&address), length) == 0);
+    REQUIRE(::getsockname(listener.get(), reinterpret_cast<sockaddr*>(&address), &length) == 0);
+    REQUIRE(::listen(listener.get(), 1) == 0);
+
+    const auto client = sr::posix::socket(AF_INET, SOCK_STREAM);
+    REQUIRE(::connect(client.get(), reinterpret_cast<sockaddr*>(&address), length) == 0);
+
+    int fd{-1};
+    {
+#if defined(__linux__)
+        const auto connection = sr::posix::accept4(listener, nullptr, nullptr, SOCK_CLOEXEC);
+#else
+        const auto connection = sr::posix::accept(listener);
+#endif
+        fd = connection.get();
+        REQUIRE(fd != -1);
+        CHECK(isOpen(fd) == true);
+    }
+    CHECK(isOpen(fd) == false);
+}
+
+TEST_CASE("accept on non listening socket returns invalid socket", "[Posix]")
+{
+    const auto s = sr::posix::socket(AF_INET, SOCK_STREAM);
+    const auto connection = sr::posix::accept(s);
+    CHECK(connection.get() == -1);
+}
+
+TEST_CASE("opendir returns owning directory", "[Posix]")
+{
+    const auto dir = sr::posix::opendir("/");
+    CHECK(dir.get() != nullptr);
+    CHECK(::readdir(dir.get()) != nullptr);
+}
+
+TEST_CASE("failed opendir returns null", "[Posix]")
+{
+    const auto dir = sr::posix::opendir("/nonexistent/dir");
+    CHECK(dir.get() == nullptr);
+}
+
+TEST_CASE("fopen returns owning file", "[Posix]")
+{
+    const auto file = sr::posix::fopen("/dev/null", "r");
+    REQUIRE(file.get() != nullptr);
+    CHECK(std::fgetc(file.get()) == EOF);
+}
+
+TEST_CASE("failed fopen returns null", "[Posix]")
+{
+    const auto file = sr::posix::fopen("/nonexistent/file", "r");
+    CHECK(file.get() == nullptr);
+}
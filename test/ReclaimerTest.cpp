@@ -0,0 +1,284 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "reclaimer.h"
+#include "unique_resource.h"
+#include "CallMocks.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    std::mutex deletedMutex;
+    std::vector<mock::Handle> deleted;
+    std::vector<std::thread::id> deleterThreads;
+    std::atomic<bool> blockDeleter{false};
+    std::atomic<bool> deleterBlocked{false};
+
+
+    struct Deleter
+    {
+        void operator()(mock::Handle h) const
+        {
+            while (blockDeleter.load() == true)
+            {
+                deleterBlocked.store(true);
+                std::this_thread::yield();
+            }
+
+            const std::lock_guard<std::mutex> lock{deletedMutex};
+            deleted.push_back(h);
+            deleterThreads.push_back(std::this_thread::get_id());
+        }
+    };
+
+    using Reclaimer = sr::reclaimer<mock::Handle, Deleter>;
+
+    void clear()
+    {
+        const std::lock_guard<std::mutex> lock{deletedMutex};
+        deleted.clear();
+        deleterThreads.clear();
+    }
+}
+
+
+TEST_CASE("deleter called on reclamation thread", "[Reclaimer]")
+{
+    clear();
+    Reclaimer reclaimer;
+
+    reclaimer.push(1);
+    reclaimer.push(2);
+    reclaimer.flush();
+
+    const std::lock_guard<std::mutex> lock{deletedMutex};
+    CHECK(deleted == std::vector<mock::Handle>{1, 2});
+    REQUIRE(deleterThreads.size() == 2);
+    CHECK(deleterThreads[0] != std::this_thread::get_id());
+}
+
+TEST_CASE("unique_resource with deferred deleter", "[Reclaimer]")
+{
+    clear();
+    Reclaimer reclaimer;
+
+    {
+        [[maybe_unused]] sr::unique_resource r1{1, reclaimer.get_deleter()};
+        sr::unique_resource r2{2, reclaimer.get_deleter()};
+        r2.reset(3);
+        sr::unique_resource r3{4, reclaimer.get_deleter()};
+        r3.release();
+    }
+    reclaimer.flush();
+
+    const std::lock_guard<std::mutex> lock{deletedMutex};
+    CHECK(deleted == std::vector<mock::Handle>{2, 3, 1});
+}
+
+TEST_CASE("drain reclaims all and deletes inline afterwards", "[Reclaimer]")
+{
+    clear();
+    Reclaimer reclaimer;
+
+    reclaimer.push(1);
+    reclaimer.drain();
+    reclaimer.push(2);
+
+    const auto stats = reclaimer.stats();
+    CHECK(stats.enqueued == 1);
+    CHECK(stats.reclaimed == 1);
+    CHECK(stats.deleted_inline == 1);
+    CHECK(stats.depth == 0);
+
+    const std::lock_guard<std::mutex> lock{deletedMutex};
+    CHECK(deleted == std::vector<mock::Handle>{1, 2});
+    CHECK(deleterThreads[1] == std::this_thread::get_id());
+}
+
+TEST_CASE("destruction reclaims pending handles", "[Reclaimer]")
+{
+    clear();
+
+    {
+        Reclaimer reclaimer;
+
+        for (mock::Handle h = 0; h < 100; ++h)
+        {
+            reclaimer.push(h);
+        }
+    }
+
+    const std::lock_guard<std::mutex> lock{deletedMutex};
+    CHECK(deleted.size() == 100);
+}
+
+TEST_CASE("full queue deletes inline with delete inline policy", "[Reclaimer]")
+{
+    clear();
+    Reclaimer reclaimer{2, sr::overflow_policy::delete_inline};
+    CHECK(reclaimer.capacity() == 2);
+
+    blockDeleter.store(true);
+    reclaimer.push(1);
+
+    while (deleterBlocked.load() == false)
+    {
+        std::this_thread::yield();
+    }
+
+    reclaimer.push(2);
+    reclaimer.push(3);
+    CHECK(reclaimer.stats().depth == 3);
+
+    std::thread inlineDeletion{[&reclaimer]
+                               { reclaimer.push(4); }};
+
+    while (reclaimer.stats().deleted_inline != 1)
+    {
+        std::this_thread::yield();
+    }
+
+    blockDeleter.store(false);
+    inlineDeletion.join();
+    reclaimer.flush();
+
+    const auto stats = reclaimer.stats();
+    CHECK(stats.enqueued == 3);
+    CHECK(stats.reclaimed == 3);
+    CHECK(stats.deleted_inline == 1);
+}
+
+TEST_CASE("full queue blocks producers with block policy", "[Reclaimer]")
+{
+    clear();
+    constexpr mock::Handle perThread{1000};
+    Reclaimer reclaimer{8, sr::overflow_policy::block};
+    std::vector<std::thread> producers;
+
+    for (mock::Handle t = 0; t < 4; ++t)
+    {
+        producers.emplace_back([&reclaimer, t]
+                               {
+            for (mock::Handle h = 0; h < perThread; ++h)
+            {
+                reclaimer.push(t * perThread + h);
+            } });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    reclaimer.flush();
+
+    const auto stats = reclaimer.stats();
+    CHECK(stats.enqueued == 4 * perThread);
+    CHECK(stats.reclaimed == 4 * perThread);
+    CHECK(stats.deleted_inline == 0);
+
+    const std::lock_guard<std::mutex> lock{deletedMutex};
+    CHECK(deleted.size() == 4 * perThread);
+}
+
+TEST_CASE("drain racing with blocked producers deletes every handle once", "[Reclaimer]")
+{
+    clear();
+    constexpr mock::Handle perThread{1000};
+    Reclaimer reclaimer{4, sr::overflow_policy::block};
+    std::vector<std::thread> producers;
+
+    for (mock::Handle t = 0; t < 4; ++t)
+    {
+        producers.emplace_back([&reclaimer, t]
+                               {
+            for (mock::Handle h = 0; h < perThread; ++h)
+            {
+                reclaimer.push(t * perThread + h);
+            } });
+    }
+    reclaimer.drain();
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    const std::lock_guard<std::mutex> lock{deletedMutex};
+    CHECK(deleted.size() == 4 * perThread);
+}
+
+TEST_CASE("flush waits for handles pushed by other threads before it", "[Reclaimer]")
+{
+    clear();
+    Reclaimer reclaimer;
+    std::atomic<bool> pushed{false};
+
+    std::thread producer{[&reclaimer, &pushed]
+                         {
+                             reclaimer.push(1);
+                             pushed.store(true);
+                         }};
+
+    while (pushed.load() == false)
+    {
+        std::this_thread::yield();
+    }
+    reclaimer.flush();
+    {
+        const std::lock_guard<std::mutex> lock{deletedMutex};
+        CHECK(deleted == std::vector<mock::Handle>{1});
+    }
+    producer.join();
+}
+
+TEST_CASE("deferred deleter requires a reclaimer", "[Reclaimer]")
+{
+    STATIC_REQUIRE_FALSE(std::is_default_constructible_v<sr::deferred<mock::Handle, Deleter>>);
+    STATIC_REQUIRE_FALSE(std::is_nothrow_invocable_v<sr::deferred<mock::Handle, Deleter>&, const mock::Handle&>);
+}
+
+TEST_CASE("idle worker is woken by push", "[Reclaimer]")
+{
+    clear();
+    Reclaimer reclaimer;
+
+    for (mock::Handle h = 0; h < 20; ++h)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        reclaimer.push(h);
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        bool done{false};
+
+        while ((done == false) && (std::chrono::steady_clock::now() < deadline))
+        {
+            const std::lock_guard<std::mutex> lock{deletedMutex};
+            done = (deleted.size() == static_cast<std::size_t>(h + 1));
+        }
+        REQUIRE(done == true);
+    }
+}
@@ -0,0 +1,235 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "resource_pool.h"
+#include "CallMocks.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    mock::CallMock m;
+
+    struct Deleter
+    {
+        void operator()(mock::Handle h) const noexcept
+        {
+            m.deleter(h);
+        }
+    };
+
+    using Pool = sr::resource_pool<mock::Handle, Deleter>;
+
+
+    auto create(mock::Handle h)
+    {
+        return [h]
+        {
+            return h;
+        };
+    }
+}
+
+
+TEST_CASE("acquire creates resource on miss", "[ResourcePool]")
+{
+    Pool pool{4, 1};
+    {
+        const auto handle = pool.acquire(create(3));
+        CHECK(handle.get() == 3);
+    }
+    const auto stats = pool.stats();
+    CHECK(stats.misses == 1);
+    CHECK(stats.hits == 0);
+    CHECK(stats.recycled == 1);
+    CHECK(stats.idle == 1);
+
+    REQUIRE_CALL(m, deleter(3));
+    pool.trim();
+}
+
+TEST_CASE("acquire reuses recycled resource", "[ResourcePool]")
+{
+    Pool pool{4, 1};
+    pool.acquire(create(3)).reset();
+    {
+        const auto handle = pool.acquire(create(4));
+        CHECK(handle.get() == 3);
+    }
+    const auto stats = pool.stats();
+    CHECK(stats.hits == 1);
+    CHECK(stats.misses == 1);
+    CHECK(stats.recycled == 2);
+
+    REQUIRE_CALL(m, deleter(3));
+    pool.trim();
+}
+
+TEST_CASE("deleter called beyond max idle", "[ResourcePool]")
+{
+    Pool pool{1, 1};
+    {
+        auto first = pool.acquire(create(3));
+        auto second = pool.acquire(create(4));
+        first.reset();
+
+        REQUIRE_CALL(m, deleter(4));
+        second.reset();
+    }
+    CHECK(pool.stats().deleted == 1);
+    CHECK(pool.stats().idle == 1);
+
+    REQUIRE_CALL(m, deleter(3));
+    pool.trim();
+}
+
+TEST_CASE("destruction deletes idle resources", "[ResourcePool]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    REQUIRE_CALL(m, deleter(4));
+    Pool pool{4, 1};
+    auto first = pool.acquire(create(3));
+    auto second = pool.acquire(create(4));
+    first.reset();
+    second.reset();
+}
+
+TEST_CASE("discard calls deleter", "[ResourcePool]")
+{
+    Pool pool{4, 1};
+    auto handle = pool.acquire(create(3));
+    {
+        REQUIRE_CALL(m, deleter(3));
+        pool.discard(std::move(handle));
+    }
+    CHECK(pool.stats().deleted == 1);
+    CHECK(pool.stats().idle == 0);
+}
+
+TEST_CASE("discard ignores released handle", "[ResourcePool]")
+{
+    REQUIRE_CALL(m, deleter(3)).TIMES(0);
+    Pool pool{4, 1};
+    auto handle = pool.acquire(create(3));
+    handle.release();
+    pool.discard(std::move(handle));
+    CHECK(pool.stats().deleted == 0);
+}
+
+TEST_CASE("released handle does not return to pool", "[ResourcePool]")
+{
+    Pool pool{4, 1};
+    auto handle = pool.acquire(create(3));
+    handle.release();
+    CHECK(pool.stats().idle == 0);
+}
+
+TEST_CASE("only owned resources return to pool", "[ResourcePool]")
+{
+    Pool pool{4, 1};
+    {
+        auto handle = pool.acquire(create(3));
+        handle.release();
+        handle.reset(4);
+    }
+
+    const auto stats = pool.stats();
+    CHECK(stats.recycled == 1);
+    CHECK(stats.idle == 1);
+    CHECK(pool.acquire(create(5)).get() == 4);
+
+    REQUIRE_CALL(m, deleter(4));
+    pool.trim();
+}
+
+TEST_CASE("failed creation with sentinel ownership is not pooled", "[ResourcePool]")
+{
+    REQUIRE_CALL(m, deleter(-1)).TIMES(0);
+    sr::resource_pool<mock::Handle, Deleter, sr::sentinel<-1>> pool{4, 1};
+    {
+        const auto handle = pool.acquire(create(-1));
+        CHECK(handle.get() == -1);
+    }
+
+    const auto stats = pool.stats();
+    CHECK(stats.misses == 1);
+    CHECK(stats.recycled == 0);
+    CHECK(stats.idle == 0);
+}
+
+TEST_CASE("sentinel ownership recycles valid resources", "[ResourcePool]")
+{
+    sr::resource_pool<mock::Handle, Deleter, sr::sentinel<-1>> pool{4, 1};
+    pool.acquire(create(3)).reset();
+    CHECK(pool.acquire(create(4)).get() == 3);
+
+    REQUIRE_CALL(m, deleter(3));
+    pool.trim();
+}
+
+TEST_CASE("default shard count", "[ResourcePool]")
+{
+    const Pool pool;
+    CHECK(pool.shard_count() >= 1);
+    CHECK(pool.max_idle() == Pool::default_max_idle);
+}
+
+TEST_CASE("concurrent use deletes each created resource once", "[ResourcePool]")
+{
+    std::atomic<int> created{0};
+    std::atomic<int> deleted{0};
+    const auto d = [&deleted](int) noexcept
+    {
+        deleted.fetch_add(1, std::memory_order_relaxed);
+    };
+    {
+        sr::resource_pool<int, std::decay_t<decltype(d)>> pool{2, 4, d};
+        std::vector<std::thread> threads;
+
+        for (int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([&pool, &created]
+                                 {
+                                     for (int j = 0; j < 1000; ++j)
+                                     {
+                                         auto first = pool.acquire([&created]
+                                                                   { return created.fetch_add(1, std::memory_order_relaxed); });
+                                         auto second = pool.acquire([&created]
+                                                                    { return created.fetch_add(1, std::memory_order_relaxed); });
+                                         auto third = pool.acquire([&created]
+                                                                   { return created.fetch_add(1, std::memory_order_relaxed); });
+                                     }
+                                 });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        const auto stats = pool.stats();
+        CHECK(stats.hits + stats.misses == 12000);
+        CHECK(stats.misses == static_cast<std::uint64_t>(created.load()));
+    }
+    CHECK(deleted.load() == created.load());
+}
@@ -23,6 +23,7 @@
 #include "scope_exit.h"
 #include "CallMocks.h"
 #include <catch2/catch_test_macros.hpp>
+#include <vector>
 
 namespace
 {
@@ -96,3 +97,56 @@ TEST_CASE("move transfers state if released", "[ScopeExit]")
     movedFrom.release();
     [[maybe_unused]] auto guard = std::move(movedFrom);
 }
+
+TEST_CASE("empty exit function does not increase size", "[ScopeExit]")
+{
+    const auto f = [] {};
+    STATIC_REQUIRE(sizeof(sr::scope_exit<decltype(f)>) == sizeof(bool));
+}
+
+TEST_CASE("fused guard calls all exit functions in reverse order", "[ScopeExit]")
+{
+    std::vector<int> calls;
+
+    {
+        [[maybe_unused]] auto guard = sr::scope_exit_all{[&calls]
+                                                         { calls.push_back(1); },
+                                                         [&calls]
+                                                         { calls.push_back(2); }};
+    }
+
+    CHECK(calls == std::vector<int>{2, 1});
+}
+
+TEST_CASE("fused guard calls no exit function if released", "[ScopeExit]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(0);
+    auto guard = sr::scope_exit_all{deleter, deleter};
+    guard.release();
+}
+
+TEST_CASE("fused guard move transfers state", "[ScopeExit]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(2);
+    auto movedFrom = sr::scope_exit_all{deleter, deleter};
+    [[maybe_unused]] auto guard = std::move(movedFrom);
+}
+
+TEST_CASE("fused guard calls constructed exit functions and rethrows on copy exception", "[ScopeExit]")
+{
+    REQUIRE_THROWS([]
+                   {
+        const mock::ThrowOnCopyMock noMove;
+        REQUIRE_CALL(m, deleter());
+        REQUIRE_CALL(noMove, deleter());
+
+        sr::scope_exit_all guard{deleter, noMove}; }());
+}
+
+TEST_CASE("fused guard with empty exit functions does not increase size", "[ScopeExit]")
+{
+    const auto f0 = [] {};
+    const auto f1 = [] {};
+    const auto f2 = [] {};
+    STATIC_REQUIRE(sizeof(sr::scope_exit_all<decltype(f0), decltype(f1), decltype(f2)>) == sizeof(bool));
+}
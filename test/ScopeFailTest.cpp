@@ -23,6 +23,7 @@
 #include "scope_fail.h"
 #include "CallMocks.h"
 #include <catch2/catch_test_macros.hpp>
+#include <vector>
 
 namespace
 {
@@ -121,3 +122,73 @@ TEST_CASE("exit function not called on pending exception", "[ScopeFail]")
         [[maybe_unused]] auto guard = sr::scope_fail{deleter};
     }
 }
+
+TEST_CASE("empty exit function does not increase size", "[ScopeFail]")
+{
+    struct Reference
+    {
+        int uncaughtOnCreation;
+        bool executeOnDestruction;
+    };
+
+    const auto f = [] {};
+    STATIC_REQUIRE(sizeof(sr::scope_fail<decltype(f)>) == sizeof(Reference));
+}
+
+TEST_CASE("fused guard calls no exit function if released", "[ScopeFail]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(0);
+    auto guard = sr::scope_fail_all{deleter, deleter};
+    guard.release();
+}
+
+TEST_CASE("fused guard calls constructed exit functions and rethrows on copy exception", "[ScopeFail]")
+{
+    REQUIRE_THROWS([]
+                   {
+        const mock::ThrowOnCopyMock noMove;
+        REQUIRE_CALL(m, deleter());
+        REQUIRE_CALL(noMove, deleter());
+
+        sr::scope_fail_all guard{deleter, noMove}; }());
+}
+
+TEST_CASE("fused guard with empty exit functions does not increase size", "[ScopeFail]")
+{
+    struct Reference
+    {
+        int uncaughtOnCreation;
+        bool executeOnDestruction;
+    };
+
+    const auto f0 = [] {};
+    const auto f1 = [] {};
+    const auto f2 = [] {};
+    STATIC_REQUIRE(sizeof(sr::scope_fail_all<decltype(f0), decltype(f1), decltype(f2)>) == sizeof(Reference));
+}
+
+TEST_CASE("fused guard calls all exit functions in reverse order on exception", "[ScopeFail]")
+{
+    std::vector<int> calls;
+
+    try
+    {
+        [[maybe_unused]] auto guard = sr::scope_fail_all{[&calls]
+                                                         { calls.push_back(1); },
+                                                         [&calls]
+                                                         { calls.push_back(2); }};
+        throw std::exception{};
+    }
+    catch (...)
+    {
+    }
+
+    CHECK(calls == std::vector<int>{2, 1});
+}
+
+TEST_CASE("fused guard calls no exit function without exception", "[ScopeFail]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(0);
+    auto movedFrom = sr::scope_fail_all{deleter, deleter};
+    [[maybe_unused]] auto guard = std::move(movedFrom);
+}
@@ -23,6 +23,7 @@
 #include "scope_success.h"
 #include "CallMocks.h"
 #include <catch2/catch_test_macros.hpp>
+#include <vector>
 
 namespace
 {
@@ -120,3 +121,75 @@ TEST_CASE("exit function called on pending exception", "[ScopeFail]")
         [[maybe_unused]] auto guard = sr::scope_success{deleter};
     }
 }
+
+TEST_CASE("empty exit function does not increase size", "[ScopeSuccess]")
+{
+    struct Reference
+    {
+        int uncaughtOnCreation;
+        bool executeOnDestruction;
+    };
+
+    const auto f = [] {};
+    STATIC_REQUIRE(sizeof(sr::scope_success<decltype(f)>) == sizeof(Reference));
+}
+
+TEST_CASE("fused guard calls no exit function if released", "[ScopeSuccess]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(0);
+    auto guard = sr::scope_success_all{deleter, deleter};
+    guard.release();
+}
+
+TEST_CASE("fused guard does not call constructed exit functions and rethrows on copy exception", "[ScopeSuccess]")
+{
+    REQUIRE_THROWS([]
+                   {
+        const mock::ThrowOnCopyMock noMove;
+        REQUIRE_CALL(m, deleter()).TIMES(0);
+        REQUIRE_CALL(noMove, deleter());
+
+        sr::scope_success_all guard{deleter, noMove}; }());
+}
+
+TEST_CASE("fused guard with empty exit functions does not increase size", "[ScopeSuccess]")
+{
+    struct Reference
+    {
+        int uncaughtOnCreation;
+        bool executeOnDestruction;
+    };
+
+    const auto f0 = [] {};
+    const auto f1 = [] {};
+    const auto f2 = [] {};
+    STATIC_REQUIRE(sizeof(sr::scope_success_all<decltype(f0), decltype(f1), decltype(f2)>) == sizeof(Reference));
+}
+
+TEST_CASE("fused guard calls all exit functions in reverse order", "[ScopeSuccess]")
+{
+    std::vector<int> calls;
+
+    {
+        auto movedFrom = sr::scope_success_all{[&calls]
+                                               { calls.push_back(1); },
+                                               [&calls]
+                                               { calls.push_back(2); }};
+        [[maybe_unused]] auto guard = std::move(movedFrom);
+    }
+
+    CHECK(calls == std::vector<int>{2, 1});
+}
+
+TEST_CASE("fused guard calls no exit function on exception", "[ScopeSuccess]")
+{
+    try
+    {
+        REQUIRE_CALL(m, deleter()).TIMES(0);
+        [[maybe_unused]] auto guard = sr::scope_success_all{deleter, deleter};
+        throw std::exception{};
+    }
+    catch (...)
+    {
+    }
+}
@@ -0,0 +1,156 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "scope_transaction.h"
+#include "CallMocks.h"
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+namespace
+{
+    mock::CallMock m;
+
+    void deleter()
+    {
+        m.deleter();
+    }
+
+    void rollback()
+    {
+        m.deleter(1);
+    }
+}
+
+
+TEST_CASE("success handler called on destruction", "[ScopeTransaction]")
+{
+    REQUIRE_CALL(m, deleter());
+    REQUIRE_CALL(m, deleter(1)).TIMES(0);
+    [[maybe_unused]] sr::scope_transaction tx{sr::on_success(deleter), sr::on_fail(rollback)};
+}
+
+TEST_CASE("fail handler called on exception", "[ScopeTransaction]")
+{
+    try
+    {
+        REQUIRE_CALL(m, deleter()).TIMES(0);
+        REQUIRE_CALL(m, deleter(1));
+        [[maybe_unused]] sr::scope_transaction tx{sr::on_success(deleter), sr::on_fail(rollback)};
+        throw std::exception{};
+    }
+    catch (...)
+    {
+    }
+}
+
+TEST_CASE("success handler called on pending exception", "[ScopeTransaction]")
+{
+    try
+    {
+        throw std::exception{};
+    }
+    catch (...)
+    {
+        REQUIRE_CALL(m, deleter());
+        [[maybe_unused]] sr::scope_transaction tx{sr::on_success(deleter), sr::on_fail(rollback)};
+    }
+}
+
+TEST_CASE("handlers are not called if released", "[ScopeTransaction]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(0);
+    sr::scope_transaction tx{sr::on_success(deleter), sr::on_success(deleter)};
+    tx.release();
+}
+
+TEST_CASE("handlers called in reverse order", "[ScopeTransaction]")
+{
+    std::vector<int> calls;
+
+    {
+        [[maybe_unused]] sr::scope_transaction tx{sr::on_success([&calls]
+                                                                 { calls.push_back(1); }),
+                                                  sr::on_fail([&calls]
+                                                              { calls.push_back(2); }),
+                                                  sr::on_success([&calls]
+                                                                 { calls.push_back(3); })};
+    }
+
+    CHECK(calls == std::vector<int>{3, 1});
+}
+
+TEST_CASE("move releases moved-from object", "[ScopeTransaction]")
+{
+    REQUIRE_CALL(m, deleter());
+    sr::scope_transaction movedFrom{sr::on_success(deleter)};
+    [[maybe_unused]] auto tx = std::move(movedFrom);
+}
+
+TEST_CASE("handlers share a single snapshot", "[ScopeTransaction]")
+{
+    const auto f1 = [] {};
+    const auto f2 = [] {};
+    const auto f3 = [] {};
+    using Transaction = sr::scope_transaction<decltype(sr::on_fail(f1)), decltype(sr::on_success(f2)), decltype(sr::on_fail(f3))>;
+    STATIC_REQUIRE(sizeof(Transaction) == sizeof(sr::scope_fail<decltype(f1)>));
+}
+
+TEST_CASE("construction from lvalue handler is noexcept only if copy is noexcept", "[ScopeTransaction]")
+{
+    struct ThrowOnCopy
+    {
+        ThrowOnCopy() = default;
+        ThrowOnCopy(const ThrowOnCopy&) noexcept(false)
+        {
+        }
+        ThrowOnCopy(ThrowOnCopy&&) noexcept = default;
+
+        void operator()() const noexcept
+        {
+        }
+    };
+
+    using Handler = decltype(sr::on_fail(ThrowOnCopy{}));
+    using Transaction = sr::scope_transaction<Handler>;
+    STATIC_REQUIRE(std::is_nothrow_constructible_v<Transaction, Handler>);
+    STATIC_REQUIRE_FALSE(std::is_nothrow_constructible_v<Transaction, Handler&>);
+}
+
+TEST_CASE("fail handler called and rethrow on copy exception", "[ScopeTransaction]")
+{
+    REQUIRE_THROWS([]
+                   {
+        const mock::ThrowOnCopyMock noMove;
+        REQUIRE_CALL(noMove, deleter());
+
+        [[maybe_unused]] const auto handler = sr::on_fail(noMove); }());
+}
+
+TEST_CASE("success handler not called on copy exception", "[ScopeTransaction]")
+{
+    REQUIRE_THROWS([]
+                   {
+        const mock::ThrowOnCopyMock noMove;
+        REQUIRE_CALL(noMove, deleter()).TIMES(0);
+
+        [[maybe_unused]] const auto handler = sr::on_success(noMove); }());
+}
@@ -0,0 +1,257 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "shared_resource.h"
+#include "CallMocks.h"
+#include "AllocationCounter.h"
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    mock::CallMock m;
+
+    void deleter(mock::Handle h)
+    {
+        m.deleter(h);
+    }
+
+
+    struct Counted
+    {
+        int value;
+        mutable std::size_t refs{1};
+    };
+
+    void intrusive_add_ref(Counted* c) noexcept
+    {
+        ++c->refs;
+    }
+
+    bool intrusive_release_ref(Counted* c) noexcept
+    {
+        return --c->refs == 0;
+    }
+
+
+    struct SumDeleter
+    {
+        void operator()(Counted* c) const
+        {
+            *sum += c->value;
+        }
+
+        int* sum;
+    };
+}
+
+
+TEST_CASE("deleter called on destruction", "[SharedResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    [[maybe_unused]] sr::shared_resource guard{mock::Handle{3}, deleter};
+}
+
+TEST_CASE("default constructed resource is empty", "[SharedResource]")
+{
+    const sr::shared_resource<mock::Handle, void (*)(mock::Handle)> guard;
+    CHECK(static_cast<bool>(guard) == false);
+    CHECK(guard.use_count() == 0);
+}
+
+TEST_CASE("construction uses a single allocation", "[SharedResource]")
+{
+    const auto before = mock::allocations;
+    const auto d = [](auto) {};
+    [[maybe_unused]] const sr::shared_resource guard{mock::Handle{3}, d};
+    CHECK(mock::allocations - before == 1);
+}
+
+TEST_CASE("copies share the resource and deleter is called once", "[SharedResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    sr::shared_resource guard{mock::Handle{3}, deleter};
+    {
+        const auto before = mock::allocations;
+        const auto copy = guard;
+        CHECK(mock::allocations == before);
+        CHECK(copy.get() == 3);
+        CHECK(guard.use_count() == 2);
+    }
+    CHECK(guard.use_count() == 1);
+}
+
+TEST_CASE("move transfers ownership", "[SharedResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    sr::shared_resource movedFrom{mock::Handle{3}, deleter};
+    const auto guard = std::move(movedFrom);
+    CHECK(static_cast<bool>(movedFrom) == false);
+    CHECK(guard.use_count() == 1);
+}
+
+TEST_CASE("assignment releases previous resource", "[SharedResource]")
+{
+    std::vector<mock::Handle> calls;
+    const auto record = [&calls](auto h)
+    {
+        calls.push_back(h);
+    };
+    {
+        sr::shared_resource guard{mock::Handle{3}, record};
+        const sr::shared_resource other{mock::Handle{4}, record};
+        guard = other;
+        CHECK(calls == std::vector<mock::Handle>{3});
+        CHECK(guard.get() == 4);
+        CHECK(other.use_count() == 2);
+    }
+    CHECK(calls == std::vector<mock::Handle>{3, 4});
+}
+
+TEST_CASE("reset drops the reference", "[SharedResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    sr::shared_resource guard{mock::Handle{3}, deleter};
+    auto copy = guard;
+    guard.reset();
+    CHECK(static_cast<bool>(guard) == false);
+    CHECK(copy.use_count() == 1);
+}
+
+TEST_CASE("construction from unique_resource takes ownership", "[SharedResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    auto unique = sr::unique_resource{mock::Handle{3}, deleter};
+    const sr::shared_resource guard{std::move(unique)};
+    CHECK(guard.get() == 3);
+    CHECK(guard.use_count() == 1);
+}
+
+TEST_CASE("construction from released unique_resource is empty", "[SharedResource]")
+{
+    REQUIRE_CALL(m, deleter(3)).TIMES(0);
+    auto unique = sr::unique_resource{mock::Handle{3}, deleter};
+    unique.release();
+    const sr::shared_resource guard{std::move(unique)};
+    CHECK(static_cast<bool>(guard) == false);
+}
+
+TEST_CASE("construction calls deleter and rethrows on failed copy", "[SharedResource]")
+{
+    REQUIRE_THROWS([]
+                   {
+        const mock::ThrowOnCopyMock noMove;
+        const auto d = [](const auto&) { m.deleter(3); };
+        REQUIRE_CALL(m, deleter(3));
+
+        [[maybe_unused]] sr::shared_resource guard{noMove, d}; }());
+}
+
+TEST_CASE("pointer access", "[SharedResource]")
+{
+    Counted c{5};
+    const auto d = [](Counted*) {};
+    const sr::shared_resource guard{&c, d};
+    CHECK(guard->value == 5);
+    CHECK((*guard).value == 5);
+}
+
+TEST_CASE("local refcount", "[SharedResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    sr::shared_resource<mock::Handle, void (*)(mock::Handle), sr::local_refcount> guard{3, deleter};
+    auto copy = guard;
+    CHECK(copy.use_count() == 2);
+    guard.reset();
+    CHECK(copy.use_count() == 1);
+}
+
+TEST_CASE("intrusive refcount does not allocate", "[SharedResource]")
+{
+    int deleted{0};
+    Counted c{5};
+    const auto d = [&deleted](Counted*)
+    {
+        ++deleted;
+    };
+    {
+        const auto before = mock::allocations;
+        const sr::shared_resource<Counted*, decltype(d), sr::intrusive_refcount> guard{&c, d};
+        auto copy = guard;
+        CHECK(c.refs == 2);
+        CHECK(copy->value == 5);
+        copy.reset();
+        CHECK(c.refs == 1);
+        CHECK(deleted == 0);
+        CHECK(mock::allocations == before);
+    }
+    CHECK(deleted == 1);
+}
+
+TEST_CASE("intrusive refcount move and assignment", "[SharedResource]")
+{
+    int deleted{0};
+    Counted first{1};
+    Counted second{2};
+    const SumDeleter d{&deleted};
+    {
+        sr::shared_resource<Counted*, SumDeleter, sr::intrusive_refcount> guard{&first, d};
+        sr::shared_resource<Counted*, SumDeleter, sr::intrusive_refcount> other{&second, d};
+        guard = std::move(other);
+        CHECK(deleted == 1);
+        CHECK(static_cast<bool>(other) == false);
+        CHECK(guard->value == 2);
+    }
+    CHECK(deleted == 3);
+}
+
+TEST_CASE("concurrent copies delete once", "[SharedResource]")
+{
+    std::atomic<int> deleted{0};
+    const auto d = [&deleted](int)
+    {
+        deleted.fetch_add(1, std::memory_order_relaxed);
+    };
+    {
+        const sr::shared_resource guard{3, d};
+        std::vector<std::thread> threads;
+
+        for (int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([guard]
+                                 {
+                                     for (int j = 0; j < 1000; ++j)
+                                     {
+                                         [[maybe_unused]] const auto copy = guard;
+                                     }
+                                 });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        CHECK(deleted.load() == 0);
+    }
+    CHECK(deleted.load() == 1);
+}
@@ -0,0 +1,277 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "timing.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct SocketDeleter
+    {
+        void operator()(int) const noexcept
+        {
+        }
+    };
+
+    struct FileDeleter
+    {
+        void operator()(int) const noexcept
+        {
+        }
+    };
+
+    struct SlowDeleter
+    {
+        void operator()(int) const noexcept
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        }
+    };
+
+    struct CustomTag
+    {
+    };
+
+
+    template <class Key>
+    std::uint64_t releaseCount()
+    {
+        return sr::timing_snapshot<Key>().release_time.count();
+    }
+
+    template <class Key>
+    std::uint64_t lifetimeCount()
+    {
+        return sr::timing_snapshot<Key>().lifetime.count();
+    }
+}
+
+
+TEST_CASE("histogram bucket of small values is exact", "[Timing]")
+{
+    for (std::uint64_t value = 0; value < sr::timing_histogram::sub_bucket_count; ++value)
+    {
+        const auto index = sr::timing_histogram::bucket_index(value);
+        CHECK(sr::timing_histogram::bucket_lower_bound(index) == value);
+        CHECK(sr::timing_histogram::bucket_upper_bound(index) == value);
+    }
+}
+
+TEST_CASE("histogram buckets contain their values", "[Timing]")
+{
+    for (const std::uint64_t value : {8ull, 15ull, 16ull, 17ull, 1000ull, 123456789ull, ~0ull})
+    {
+        const auto index = sr::timing_histogram::bucket_index(value);
+        CHECK(index < sr::timing_histogram::bucket_count);
+        CHECK(sr::timing_histogram::bucket_lower_bound(index) <= value);
+        CHECK(sr::timing_histogram::bucket_upper_bound(index) >= value);
+    }
+}
+
+TEST_CASE("histogram buckets are contiguous", "[Timing]")
+{
+    for (std::size_t i = 1; i < sr::timing_histogram::bucket_count; ++i)
+    {
+        CHECK(sr::timing_histogram::bucket_lower_bound(i) == sr::timing_histogram::bucket_upper_bound(i - 1) + 1);
+    }
+}
+
+TEST_CASE("histogram bucket width is relative to value", "[Timing]")
+{
+    const auto index = sr::timing_histogram::bucket_index(1000);
+    const auto width = sr::timing_histogram::bucket_upper_bound(index) - sr::timing_histogram::bucket_lower_bound(index) + 1;
+    CHECK(width * sr::timing_histogram::sub_bucket_count <= 1000);
+}
+
+TEST_CASE("histogram records and merges", "[Timing]")
+{
+    sr::timing_histogram first;
+    first.record(3);
+    first.record(1000);
+    sr::timing_histogram second;
+    second.record(1000, 2);
+
+    first.merge(second);
+    CHECK(first.count() == 4);
+    CHECK(first.count(sr::timing_histogram::bucket_index(3)) == 1);
+    CHECK(first.count(sr::timing_histogram::bucket_index(1000)) == 3);
+}
+
+TEST_CASE("histogram quantile", "[Timing]")
+{
+    sr::timing_histogram histogram;
+    CHECK(histogram.value_at_quantile(0.5) == 0);
+
+    histogram.record(1, 99);
+    histogram.record(5000);
+    CHECK(histogram.value_at_quantile(0.5) == 1);
+    CHECK(histogram.value_at_quantile(0.98) == 1);
+    CHECK(histogram.value_at_quantile(1.0) >= 5000);
+}
+
+TEST_CASE("clock is monotonic", "[Timing]")
+{
+    const auto first = sr::timing_clock::now();
+    const auto second = sr::timing_clock::now();
+    CHECK(second >= first);
+    CHECK(sr::timing_clock::nanoseconds_per_tick() > 0.0);
+}
+
+TEST_CASE("timed unique_resource records release time and lifetime", "[Timing]")
+{
+    const auto releases = releaseCount<SocketDeleter>();
+    const auto lifetimes = lifetimeCount<SocketDeleter>();
+    {
+        [[maybe_unused]] sr::timed_unique_resource<int, SocketDeleter> first{3, SocketDeleter{}};
+        [[maybe_unused]] sr::timed_unique_resource<int, SocketDeleter> second{4, SocketDeleter{}};
+    }
+    CHECK(releaseCount<SocketDeleter>() - releases == 2);
+    CHECK(lifetimeCount<SocketDeleter>() - lifetimes == 2);
+}
+
+TEST_CASE("timed unique_resource records per deleter type", "[Timing]")
+{
+    const auto sockets = releaseCount<SocketDeleter>();
+    const auto files = releaseCount<FileDeleter>();
+    {
+        [[maybe_unused]] sr::timed_unique_resource<int, FileDeleter> resource{3, FileDeleter{}};
+    }
+    CHECK(releaseCount<SocketDeleter>() == sockets);
+    CHECK(releaseCount<FileDeleter>() - files == 1);
+}
+
+TEST_CASE("timed unique_resource records with tag", "[Timing]")
+{
+    const auto tagged = releaseCount<CustomTag>();
+    const auto files = releaseCount<FileDeleter>();
+    {
+        [[maybe_unused]] sr::timed_unique_resource<int, FileDeleter, sr::detail::ownership_flag, CustomTag> resource{3, FileDeleter{}};
+    }
+    CHECK(releaseCount<CustomTag>() - tagged == 1);
+    CHECK(releaseCount<FileDeleter>() == files);
+}
+
+TEST_CASE("timed unique_resource does not record release or move", "[Timing]")
+{
+    const auto releases = releaseCount<SocketDeleter>();
+    {
+        sr::timed_unique_resource<int, SocketDeleter> released{3, SocketDeleter{}};
+        released.release();
+
+        sr::timed_unique_resource<int, SocketDeleter> moved{4, SocketDeleter{}};
+        [[maybe_unused]] sr::timed_unique_resource<int, SocketDeleter> target{std::move(moved)};
+    }
+    CHECK(releaseCount<SocketDeleter>() - releases == 1);
+}
+
+TEST_CASE("timed unique_resource records reset", "[Timing]")
+{
+    const auto releases = releaseCount<SocketDeleter>();
+    {
+        sr::timed_unique_resource<int, SocketDeleter> resource{3, SocketDeleter{}};
+        resource.reset(4);
+        CHECK(releaseCount<SocketDeleter>() - releases == 1);
+    }
+    CHECK(releaseCount<SocketDeleter>() - releases == 2);
+}
+
+TEST_CASE("timed unique_resource with sentinel", "[Timing]")
+{
+    const auto releases = releaseCount<FileDeleter>();
+    {
+        sr::timed_unique_resource<int, FileDeleter, sr::sentinel<-1>> resource{3, FileDeleter{}};
+        [[maybe_unused]] sr::timed_unique_resource<int, FileDeleter, sr::sentinel<-1>> invalid{-1, FileDeleter{}};
+        CHECK(resource.get() == 3);
+    }
+    CHECK(releaseCount<FileDeleter>() - releases == 1);
+}
+
+TEST_CASE("timed unique_resource measures slow deleter", "[Timing]")
+{
+    {
+        [[maybe_unused]] sr::timed_unique_resource<int, SlowDeleter> resource{3, SlowDeleter{}};
+    }
+    const auto entry = sr::timing_snapshot<SlowDeleter>();
+    REQUIRE(entry.release_time.count() == 1);
+    CHECK(sr::timing_clock::to_nanoseconds(entry.release_time.value_at_quantile(1.0)) >= 10'000'000);
+}
+
+TEST_CASE("timing snapshot aggregates all threads", "[Timing]")
+{
+    constexpr std::size_t threadCount{4};
+    constexpr std::size_t iterations{100};
+    const auto before = releaseCount<FileDeleter>();
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([]
+                             {
+                                 for (std::size_t n = 0; n < iterations; ++n)
+                                 {
+                                     [[maybe_unused]] sr::timed_unique_resource<int, FileDeleter> resource{3, FileDeleter{}};
+                                 } });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    CHECK(releaseCount<FileDeleter>() - before == threadCount * iterations);
+}
+
+TEST_CASE("timing snapshot lists all keys", "[Timing]")
+{
+    {
+        [[maybe_unused]] sr::timed_unique_resource<int, SocketDeleter> resource{3, SocketDeleter{}};
+    }
+    const auto entries = sr::timing_snapshot();
+    const auto name = sr::instrument_name<SocketDeleter>;
+    std::size_t found{0};
+
+    for (const auto& entry : entries)
+    {
+        if (std::strcmp(entry.name, name) == 0)
+        {
+            ++found;
+            CHECK(entry.release_time.count() > 0);
+        }
+    }
+    CHECK(found == 1);
+}
+
+TEST_CASE("timing dump", "[Timing]")
+{
+    sr::timing_entry entry{"socket", {}, {}};
+    entry.release_time.record(3);
+    entry.lifetime.record(1000);
+
+    std::ostringstream out;
+    sr::dump_timing(out, std::vector<sr::timing_entry>{entry});
+    CHECK(out.str().find("socket release time (1 samples") != std::string::npos);
+    CHECK(out.str().find("socket lifetime (1 samples") != std::string::npos);
+}
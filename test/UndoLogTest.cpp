@@ -0,0 +1,172 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "undo_log.h"
+#include "CallMocks.h"
+#include "AllocationCounter.h"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    mock::CallMock m;
+
+    void rollback()
+    {
+        m.deleter();
+    }
+}
+
+
+TEST_CASE("rollback functions not called on destruction", "[UndoLog]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(0);
+    sr::undo_log log;
+    log.push(rollback);
+    log.push(rollback);
+}
+
+TEST_CASE("rollback functions called in reverse order on exception", "[UndoLog]")
+{
+    std::vector<int> calls;
+
+    try
+    {
+        sr::undo_log log;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            log.push([&calls, i]
+                     { calls.push_back(i); });
+        }
+        throw std::exception{};
+    }
+    catch (...)
+    {
+    }
+
+    CHECK(calls == std::vector<int>{2, 1, 0});
+}
+
+TEST_CASE("rollback functions not called on pending exception", "[UndoLog]")
+{
+    try
+    {
+        throw std::exception{};
+    }
+    catch (...)
+    {
+        REQUIRE_CALL(m, deleter()).TIMES(0);
+        sr::undo_log log;
+        log.push(rollback);
+    }
+}
+
+TEST_CASE("rollback functions not called on exception after commit", "[UndoLog]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(0);
+
+    try
+    {
+        sr::undo_log log;
+        log.push(rollback);
+        log.push(rollback);
+        log.commit();
+        CHECK(log.empty() == true);
+        throw std::exception{};
+    }
+    catch (...)
+    {
+    }
+}
+
+TEST_CASE("rollback calls all rollback functions", "[UndoLog]")
+{
+    REQUIRE_CALL(m, deleter()).TIMES(2);
+    sr::undo_log log;
+    log.push(rollback);
+    log.push(rollback);
+    log.rollback();
+    CHECK(log.empty() == true);
+}
+
+TEST_CASE("rollback to savepoint undoes suffix only", "[UndoLog]")
+{
+    std::vector<int> calls;
+    sr::undo_log log;
+
+    log.push([&calls]
+             { calls.push_back(0); });
+    const auto sp = log.savepoint();
+    log.push([&calls]
+             { calls.push_back(1); });
+    log.push([&calls]
+             { calls.push_back(2); });
+
+    log.rollback_to(sp);
+    CHECK(calls == std::vector<int>{2, 1});
+    CHECK(log.size() == 1);
+
+    log.rollback();
+    CHECK(calls == std::vector<int>{2, 1, 0});
+}
+
+TEST_CASE("rollback function called and rethrow on copy exception", "[UndoLog]")
+{
+    REQUIRE_THROWS([]
+                   {
+        const mock::ThrowOnCopyMock noMove;
+        REQUIRE_CALL(noMove, deleter());
+
+        sr::undo_log log;
+        log.push(noMove); }());
+}
+
+TEST_CASE("commit destroys rollback functions", "[UndoLog]")
+{
+    auto shared = std::make_shared<int>(0);
+    sr::undo_log log;
+
+    log.push([shared]
+             { ++*shared; });
+    log.commit();
+
+    CHECK(shared.use_count() == 1);
+    CHECK(*shared == 0);
+}
+
+TEST_CASE("rollback functions within buffer do not allocate", "[UndoLog]")
+{
+    int value{0};
+    sr::undo_log<128> log;
+    const auto before = mock::allocations;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        log.push([&value]
+                 { --value; });
+    }
+    log.commit();
+
+    CHECK(mock::allocations == before);
+}
@@ -0,0 +1,167 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "unique_mapping.h"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <unistd.h>
+
+namespace
+{
+    class TempFile
+    {
+    public:
+        explicit TempFile(const std::string& content)
+            : path("/tmp/UniqueMappingTestXXXXXX"),
+              fd(::mkstemp(path.data()), sr::posix::fd_deleter{})
+        {
+            REQUIRE(fd.get() != -1);
+            REQUIRE(::write(fd.get(), content.data(), content.size()) == static_cast<ssize_t>(content.size()));
+        }
+
+        TempFile(const TempFile&) = delete;
+
+        ~TempFile()
+        {
+            ::unlink(path.c_str());
+        }
+
+        const sr::posix::unique_fd& get() const
+        {
+            return fd;
+        }
+
+        TempFile& operator=(const TempFile&) = delete;
+
+    private:
+        std::string path;
+        sr::posix::unique_fd fd;
+    };
+
+
+    std::size_t pageSize()
+    {
+        return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    }
+}
+
+
+TEST_CASE("mapping has size of pointer and length", "[UniqueMapping]")
+{
+    STATIC_REQUIRE(sizeof(sr::posix::unique_mapping) == sizeof(void*) + sizeof(std::size_t));
+}
+
+TEST_CASE("default constructed mapping is empty", "[UniqueMapping]")
+{
+    const sr::posix::unique_mapping mapping;
+    CHECK(static_cast<bool>(mapping) == false);
+    CHECK(mapping.size() == 0);
+    CHECK(mapping.view().empty() == true);
+}
+
+TEST_CASE("map file exposes content", "[UniqueMapping]")
+{
+    const TempFile file{"scope guard"};
+    const auto mapping = sr::posix::unique_mapping::map(file.get(), 11);
+    REQUIRE(static_cast<bool>(mapping) == true);
+    CHECK(mapping.view() == "scope guard");
+    CHECK(mapping.bytes().size() == 11);
+    CHECK(mapping.bytes()[0] == std::byte{'s'});
+}
+
+TEST_CASE("bytes of mutable mapping are writable", "[UniqueMapping]")
+{
+    auto mapping = sr::posix::unique_mapping::map_anonymous(pageSize());
+    REQUIRE(static_cast<bool>(mapping) == true);
+    mapping.bytes()[0] = std::byte{7};
+    CHECK(std::as_const(mapping).bytes()[0] == std::byte{7});
+    STATIC_REQUIRE(std::is_same_v<decltype(std::as_const(mapping).data()), const std::byte*>);
+    STATIC_REQUIRE(std::is_same_v<decltype(std::as_const(mapping).bytes()), sr::posix::mapping_view<const std::byte>>);
+}
+
+TEST_CASE("map range of file", "[UniqueMapping]")
+{
+    const std::string content = std::string(pageSize(), 'a') + "range";
+    const TempFile file{content};
+    const auto mapping = sr::posix::unique_mapping::map(file.get(), 5, static_cast<off_t>(pageSize()));
+    REQUIRE(static_cast<bool>(mapping) == true);
+    CHECK(mapping.view() == "range");
+}
+
+TEST_CASE("failed map is empty", "[UniqueMapping]")
+{
+    const sr::posix::unique_fd invalid;
+    const auto mapping = sr::posix::unique_mapping::map(invalid, 16);
+    CHECK(static_cast<bool>(mapping) == false);
+    CHECK(mapping.data() == nullptr);
+    CHECK(mapping.size() == 0);
+}
+
+TEST_CASE("release transfers region", "[UniqueMapping]")
+{
+    auto mapping = sr::posix::unique_mapping::map_anonymous(pageSize());
+    REQUIRE(static_cast<bool>(mapping) == true);
+    const auto region = mapping.release();
+    CHECK(static_cast<bool>(mapping) == false);
+    CHECK(::munmap(region.address, region.length) == 0);
+}
+
+TEST_CASE("move transfers ownership", "[UniqueMapping]")
+{
+    auto movedFrom = sr::posix::unique_mapping::map_anonymous(pageSize());
+    const auto address = movedFrom.data();
+    const auto mapping = std::move(movedFrom);
+    CHECK(static_cast<bool>(movedFrom) == false);
+    CHECK(mapping.data() == address);
+}
+
+TEST_CASE("advise mapping", "[UniqueMapping]")
+{
+    auto mapping = sr::posix::unique_mapping::map_anonymous(pageSize());
+    CHECK(mapping.advise(sr::posix::advice::sequential) == true);
+    CHECK(mapping.advise(sr::posix::advice::willneed, 0, pageSize()) == true);
+}
+
+TEST_CASE("advise empty mapping fails", "[UniqueMapping]")
+{
+    sr::posix::unique_mapping mapping;
+    CHECK(mapping.advise(sr::posix::advice::sequential) == false);
+}
+
+#if defined(__linux__)
+TEST_CASE("remap keeps content", "[UniqueMapping]")
+{
+    auto mapping = sr::posix::unique_mapping::map_anonymous(pageSize());
+    mapping.data()[0] = std::byte{7};
+
+    REQUIRE(mapping.remap(4 * pageSize()) == true);
+    CHECK(mapping.size() == 4 * pageSize());
+    CHECK(mapping.data()[0] == std::byte{7});
+    mapping.data()[4 * pageSize() - 1] = std::byte{1};
+
+    REQUIRE(mapping.remap(pageSize()) == true);
+    CHECK(mapping.size() == pageSize());
+}
+#endif
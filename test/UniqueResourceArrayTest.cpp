@@ -0,0 +1,238 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "unique_resource_array.h"
+#include "CallMocks.h"
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+    std::vector<mock::Handle> deleted;
+
+    struct Deleter
+    {
+        void operator()(mock::Handle h) const
+        {
+            deleted.push_back(h);
+        }
+    };
+
+    using Array = sr::unique_resource_array<mock::Handle, Deleter>;
+
+    std::vector<mock::Handle> liveHandles(const Array& array)
+    {
+        return {array.live_handles().begin(), array.live_handles().end()};
+    }
+}
+
+
+TEST_CASE("deleter called for all handles on destruction", "[UniqueResourceArray]")
+{
+    deleted.clear();
+
+    {
+        Array array;
+        array.emplace(1);
+        array.emplace(2);
+        CHECK(array.size() == 2);
+    }
+
+    CHECK(deleted == std::vector<mock::Handle>{1, 2});
+}
+
+TEST_CASE("emplace returns index", "[UniqueResourceArray]")
+{
+    Array array;
+    CHECK(array.emplace(5) == 0);
+    CHECK(array.emplace(6) == 1);
+    CHECK(array[1] == 6);
+    CHECK(array.get(0) == 5);
+    array.clear();
+}
+
+TEST_CASE("deleter not called for released handle", "[UniqueResourceArray]")
+{
+    deleted.clear();
+
+    {
+        Array array;
+        array.emplace(1);
+        array.emplace(2);
+        array.release(0);
+        CHECK(array.owns(0) == false);
+        CHECK(array.owns(1) == true);
+    }
+
+    CHECK(deleted == std::vector<mock::Handle>{2});
+}
+
+TEST_CASE("reset calls deleter once", "[UniqueResourceArray]")
+{
+    deleted.clear();
+
+    {
+        Array array;
+        array.emplace(1);
+        array.reset(0);
+        array.reset(0);
+        CHECK(array.owns(0) == false);
+        CHECK(deleted == std::vector<mock::Handle>{1});
+    }
+
+    CHECK(deleted == std::vector<mock::Handle>{1});
+}
+
+TEST_CASE("reset with new value takes ownership", "[UniqueResourceArray]")
+{
+    deleted.clear();
+
+    {
+        Array array;
+        array.emplace(1);
+        array.reset(0, 7);
+        CHECK(array[0] == 7);
+        CHECK(array.owns(0) == true);
+    }
+
+    CHECK(deleted == std::vector<mock::Handle>{1, 7});
+}
+
+TEST_CASE("emplace reuses slot of reset handle", "[UniqueResourceArray]")
+{
+    deleted.clear();
+    Array array;
+    array.emplace(1);
+    const auto index = array.emplace(2);
+    array.emplace(3);
+
+    for (mock::Handle h = 10; h < 20; ++h)
+    {
+        array.reset(index);
+        CHECK(array.emplace(h) == index);
+        CHECK(array.size() == 3);
+    }
+    CHECK(deleted == std::vector<mock::Handle>{2, 10, 11, 12, 13, 14, 15, 16, 17, 18});
+}
+
+TEST_CASE("emplace reuses lowest released slot across words", "[UniqueResourceArray]")
+{
+    deleted.clear();
+    Array array;
+
+    for (mock::Handle h = 0; h < 130; ++h)
+    {
+        array.emplace(h);
+    }
+    array.release(100);
+    array.release(70);
+    array.release(129);
+
+    CHECK(array.emplace(1000) == 70);
+    CHECK(array.emplace(1001) == 100);
+    CHECK(array.emplace(1002) == 129);
+    CHECK(array.emplace(1003) == 130);
+    CHECK(array.size() == 131);
+}
+
+TEST_CASE("reset all deletes live handles only", "[UniqueResourceArray]")
+{
+    deleted.clear();
+    Array array;
+
+    for (mock::Handle h = 0; h < 4; ++h)
+    {
+        array.emplace(h);
+    }
+    array.release(2);
+    array.reset_all();
+
+    CHECK(deleted == std::vector<mock::Handle>{0, 1, 3});
+    CHECK(array.live_size() == 0);
+    CHECK(array.size() == 4);
+}
+
+TEST_CASE("iteration visits live handles across words", "[UniqueResourceArray]")
+{
+    Array array;
+    array.reserve(200);
+
+    for (mock::Handle h = 0; h < 200; ++h)
+    {
+        array.emplace(h);
+    }
+
+    for (mock::Handle h = 0; h < 200; ++h)
+    {
+        if ((h % 3) != 0)
+        {
+            array.release(static_cast<std::size_t>(h));
+        }
+    }
+
+    std::vector<mock::Handle> expected;
+
+    for (mock::Handle h = 0; h < 200; h += 3)
+    {
+        expected.push_back(h);
+    }
+
+    CHECK(liveHandles(array) == expected);
+    CHECK(array.live_size() == expected.size());
+    CHECK(std::next(array.live_handles().begin(), 2).index() == 6);
+    array.clear();
+}
+
+TEST_CASE("iteration of empty array", "[UniqueResourceArray]")
+{
+    Array array;
+    CHECK(liveHandles(array).empty() == true);
+    array.emplace(1);
+    array.release(0);
+    CHECK(liveHandles(array).empty() == true);
+}
+
+TEST_CASE("move transfers ownership", "[UniqueResourceArray]")
+{
+    deleted.clear();
+
+    {
+        Array movedFrom;
+        movedFrom.emplace(1);
+        Array array{std::move(movedFrom)};
+        CHECK(movedFrom.empty() == true);
+        CHECK(array.owns(0) == true);
+
+        Array assigned;
+        assigned.emplace(2);
+        assigned = std::move(array);
+        CHECK(deleted == std::vector<mock::Handle>{2});
+    }
+
+    CHECK(deleted == std::vector<mock::Handle>{2, 1});
+}
+
+TEST_CASE("empty deleter does not increase size", "[UniqueResourceArray]")
+{
+    STATIC_REQUIRE(sizeof(Array) == sizeof(std::vector<mock::Handle>) + sizeof(std::vector<std::uint64_t>) + sizeof(std::size_t));
+}
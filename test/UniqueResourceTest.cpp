@@ -254,3 +254,113 @@ TEST_CASE("not noexcept move and copy assignable deleter", "[UniqueResource]")
     [[maybe_unused]] sr::unique_resource guard{0, mock::FunctionDeleter{}};
     guard = std::move(movedFrom);
 }
+
+TEST_CASE("empty deleter does not increase size", "[UniqueResource]")
+{
+    struct Reference
+    {
+        mock::Handle handle;
+        bool executeOnReset;
+    };
+
+    const auto d = [](mock::Handle) {};
+
+    STATIC_REQUIRE(sizeof(sr::unique_resource<mock::Handle, mock::FunctionDeleter>) == sizeof(Reference));
+    STATIC_REQUIRE(sizeof(sr::unique_resource<mock::Handle, decltype(d)>) == sizeof(Reference));
+    STATIC_REQUIRE(sizeof(sr::unique_resource<mock::PtrHandle, mock::FunctionDeleter>) == sizeof(mock::PtrHandle) * 2);
+}
+
+TEST_CASE("sentinel ownership has size of resource", "[UniqueResource]")
+{
+    STATIC_REQUIRE(sizeof(sr::unique_resource<mock::Handle, mock::FunctionDeleter, sr::sentinel<-1>>) == sizeof(mock::Handle));
+    STATIC_REQUIRE(sizeof(sr::unique_resource<mock::PtrHandle, mock::FunctionDeleter, sr::sentinel<nullptr>>) == sizeof(mock::PtrHandle));
+}
+
+TEST_CASE("sentinel default construction is invalid", "[UniqueResource]")
+{
+    sr::unique_resource<mock::Handle, mock::FunctionDeleter, sr::sentinel<-1>> guard{};
+    CHECK(guard.get() == -1);
+}
+
+TEST_CASE("sentinel deleter called on destruction", "[UniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    [[maybe_unused]] sr::unique_resource<mock::Handle, void (*)(mock::Handle), sr::sentinel<-1>> guard{3, deleter};
+}
+
+TEST_CASE("sentinel deleter not called on invalid resource", "[UniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(-1)).TIMES(0);
+    [[maybe_unused]] sr::unique_resource<mock::Handle, void (*)(mock::Handle), sr::sentinel<-1>> guard{-1, deleter};
+}
+
+TEST_CASE("sentinel release sets invalid resource", "[UniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3)).TIMES(0);
+    sr::unique_resource<mock::Handle, void (*)(mock::Handle), sr::sentinel<-1>> guard{3, deleter};
+    guard.release();
+    CHECK(guard.get() == -1);
+}
+
+TEST_CASE("sentinel reset calls deleter once", "[UniqueResource]")
+{
+    sr::unique_resource<mock::Handle, void (*)(mock::Handle), sr::sentinel<-1>> guard{3, deleter};
+
+    {
+        REQUIRE_CALL(m, deleter(3));
+        guard.reset();
+        guard.reset();
+    }
+    CHECK(guard.get() == -1);
+}
+
+TEST_CASE("sentinel reset sets new value and calls deleter on previous", "[UniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    REQUIRE_CALL(m, deleter(7));
+    sr::unique_resource<mock::Handle, void (*)(mock::Handle), sr::sentinel<-1>> guard{3, deleter};
+    guard.reset(7);
+}
+
+TEST_CASE("sentinel move-construction invalidates moved-from object", "[UniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(3));
+    sr::unique_resource<mock::Handle, void (*)(mock::Handle), sr::sentinel<-1>> movedFrom{3, deleter};
+    auto guard = std::move(movedFrom);
+    CHECK(guard.get() == 3);
+    CHECK(movedFrom.get() == -1);
+}
+
+TEST_CASE("sentinel move assignment calls deleter", "[UniqueResource]")
+{
+    sr::unique_resource<mock::Handle, void (*)(mock::Handle), sr::sentinel<-1>> movedFrom{3, deleter};
+    REQUIRE_CALL(m, deleter(4));
+
+    {
+        REQUIRE_CALL(m, deleter(3));
+        sr::unique_resource<mock::Handle, void (*)(mock::Handle), sr::sentinel<-1>> guard{4, deleter};
+        guard = std::move(movedFrom);
+        CHECK(movedFrom.get() == -1);
+    }
+}
+
+TEST_CASE("sentinel pointer resource", "[UniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(5));
+    mock::Handle h{5};
+    sr::unique_resource<mock::PtrHandle, void (*)(mock::PtrHandle), sr::sentinel<nullptr>> guard{&h, [](mock::PtrHandle p)
+                                                                                                 { deleter(*p); }};
+    CHECK(*guard == 5);
+}
+
+TEST_CASE("make unique resource checked with sentinel", "[UniqueResource]")
+{
+    REQUIRE_CALL(m, deleter(4));
+    auto guard = sr::make_unique_resource_checked<-1>(mock::Handle{4}, deleter);
+    STATIC_REQUIRE(std::is_same_v<decltype(guard), sr::unique_resource<mock::Handle, void (*)(mock::Handle), sr::sentinel<-1>>>);
+}
+
+TEST_CASE("make unique resource checked with sentinel releases if invalid", "[UniqueResource]")
+{
+    [[maybe_unused]] auto guard = sr::make_unique_resource_checked<-1>(mock::Handle{-1}, deleter);
+}
@@ -0,0 +1,72 @@
+# Compares the generated code of each codegen_*_guarded function with its
+# codegen_*_reference counterpart.
+#
+# Usage: cmake -DCODEGEN_ASM=<file> -P CheckCodegen.cmake
+
+if( NOT CODEGEN_ASM )
+    message(FATAL_ERROR "CODEGEN_ASM not set")
+endif()
+
+file(STRINGS "${CODEGEN_ASM}" lines)
+
+set(current "")
+set(functions "")
+
+foreach(line IN LISTS lines)
+    if( line MATCHES "^(codegen_[A-Za-z0-9_]+_(guarded|reference))(\\.cold[.0-9]*)?:" )
+        set(current "${CMAKE_MATCH_1}")
+        list(APPEND functions "${current}")
+
+        if( NOT DEFINED instructions_${current} )
+            set(instructions_${current} 0)
+            set(lsda_${current} FALSE)
+        endif()
+    elseif( current )
+        string(STRIP "${line}" stripped)
+
+        if( stripped MATCHES "^\\.cfi_lsda" )
+            set(lsda_${current} TRUE)
+        elseif( stripped MATCHES "^\\.cfi_endproc" OR stripped MATCHES "^\\.size[ \t]+codegen_" )
+            set(current "")
+        elseif( NOT stripped STREQUAL "" AND NOT stripped MATCHES "^[.#;@]" AND NOT stripped MATCHES ":$" )
+            math(EXPR instructions_${current} "${instructions_${current}} + 1")
+        endif()
+    endif()
+endforeach()
+
+list(REMOVE_DUPLICATES functions)
+list(FILTER functions INCLUDE REGEX "_guarded$")
+
+if( NOT functions )
+    message(FATAL_ERROR "No codegen functions found in ${CODEGEN_ASM}")
+endif()
+
+set(failed FALSE)
+
+foreach(guarded IN LISTS functions)
+    string(REGEX REPLACE "_guarded$" "_reference" reference "${guarded}")
+
+    if( NOT DEFINED instructions_${reference} )
+        message(SEND_ERROR "${guarded}: no reference function ${reference}")
+        set(failed TRUE)
+        continue()
+    endif()
+
+    set(actual ${instructions_${guarded}})
+    set(expected ${instructions_${reference}})
+    message(STATUS "${guarded}: ${actual} instructions (reference: ${expected})")
+
+    if( actual GREATER expected )
+        message(SEND_ERROR "${guarded}: ${actual} instructions, hand-written reference has ${expected}")
+        set(failed TRUE)
+    endif()
+
+    if( lsda_${guarded} AND NOT lsda_${reference} )
+        message(SEND_ERROR "${guarded}: landing pad not present in hand-written reference")
+        set(failed TRUE)
+    endif()
+endforeach()
+
+if( failed )
+    message(FATAL_ERROR "Codegen check failed")
+endif()
@@ -0,0 +1,256 @@
+// MIT License
+//
+// Copyright (c) 2017-2026 offa
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "cold.h"
+#include "function_constant.h"
+#include "scope_exit.h"
+#include "scope_fail.h"
+#include "unique_resource.h"
+#include <exception>
+
+// Each *_guarded function must not compile to more instructions than its
+// hand-written *_reference counterpart (see CheckCodegen.cmake).
+
+extern "C"
+{
+    void codegen_work();
+    void codegen_work_on(int handle);
+    void codegen_cleanup();
+    void codegen_log(int value);
+    void codegen_close(int handle);
+    int codegen_acquire() noexcept;
+    bool codegen_condition() noexcept;
+
+
+    void codegen_scope_exit_guarded()
+    {
+        sr::scope_exit guard{[]
+                             { codegen_cleanup(); }};
+        codegen_work();
+    }
+
+    void codegen_scope_exit_reference()
+    {
+        struct Guard
+        {
+            ~Guard()
+            {
+                codegen_cleanup();
+            }
+        } guard;
+        codegen_work();
+    }
+
+
+    void codegen_scope_exit_release_guarded()
+    {
+        sr::scope_exit guard{[]
+                             { codegen_cleanup(); }};
+        codegen_work();
+
+        if (codegen_condition() == true)
+        {
+            guard.release();
+        }
+    }
+
+    void codegen_scope_exit_release_reference()
+    {
+        struct Guard
+        {
+            ~Guard()
+            {
+                if (execute == true)
+                {
+                    codegen_cleanup();
+                }
+            }
+
+            bool execute;
+        } guard{true};
+        codegen_work();
+
+        if (codegen_condition() == true)
+        {
+            guard.execute = false;
+        }
+    }
+
+
+    void codegen_unique_resource_guarded()
+    {
+        sr::unique_resource<int, void (*)(int)> resource{codegen_acquire(), &codegen_close};
+        codegen_work_on(resource.get());
+    }
+
+    void codegen_unique_resource_reference()
+    {
+        struct Resource
+        {
+            ~Resource()
+            {
+                codegen_close(handle);
+            }
+
+            int handle;
+        } resource{codegen_acquire()};
+        codegen_work_on(resource.handle);
+    }
+
+
+    void codegen_unique_resource_function_constant_guarded()
+    {
+        sr::unique_resource<int, sr::fn_deleter<&codegen_close>, sr::sentinel<-1>> resource{codegen_acquire(), sr::fn_deleter<&codegen_close>{}};
+        codegen_work_on(resource.get());
+    }
+
+    void codegen_unique_resource_function_constant_reference()
+    {
+        struct Resource
+        {
+            ~Resource()
+            {
+                if (handle != -1)
+                {
+                    codegen_close(handle);
+                }
+            }
+
+            int handle;
+        } resource{codegen_acquire()};
+        codegen_work_on(resource.handle);
+    }
+
+
+    void codegen_unique_resource_sentinel_guarded()
+    {
+        sr::unique_resource<int, void (*)(int), sr::sentinel<-1>> resource{codegen_acquire(), &codegen_close};
+        codegen_work_on(resource.get());
+    }
+
+    void codegen_unique_resource_sentinel_reference()
+    {
+        struct Resource
+        {
+            ~Resource()
+            {
+                if (handle != -1)
+                {
+                    codegen_close(handle);
+                }
+            }
+
+            int handle;
+        } resource{codegen_acquire()};
+        codegen_work_on(resource.handle);
+    }
+
+
+    void codegen_scope_fail_guarded()
+    {
+        sr::scope_fail guard{[]
+                             { codegen_cleanup(); }};
+        codegen_work();
+    }
+
+    void codegen_scope_fail_reference()
+    {
+        struct Guard
+        {
+            ~Guard()
+            {
+                if (std::uncaught_exceptions() > uncaught)
+                {
+                    codegen_cleanup();
+                }
+            }
+
+            int uncaught;
+        } guard{std::uncaught_exceptions()};
+        codegen_work();
+    }
+
+
+    void codegen_scope_fail_cold_guarded()
+    {
+        sr::scope_fail guard{sr::cold{[]() noexcept
+                                      {
+                                          codegen_log(1);
+                                          codegen_log(2);
+                                          codegen_log(3);
+                                          codegen_cleanup();
+                                      }}};
+        codegen_work();
+    }
+
+    void codegen_scope_fail_cold_reference()
+    {
+        struct Guard
+        {
+            ~Guard()
+            {
+                if (std::uncaught_exceptions() > uncaught)
+                {
+                    codegen_log(1);
+                    codegen_log(2);
+                    codegen_log(3);
+                    codegen_cleanup();
+                }
+            }
+
+            int uncaught;
+        } guard{std::uncaught_exceptions()};
+        codegen_work();
+    }
+
+
+    void codegen_unique_resource_cold_guarded()
+    {
+        const auto close = [](int handle) noexcept
+        {
+            codegen_log(handle);
+            codegen_log(handle + 1);
+            codegen_close(handle);
+        };
+        const auto resource = sr::make_unique_resource_checked<-1>(codegen_acquire(), sr::cold{close});
+        codegen_work_on(resource.get());
+    }
+
+    void codegen_unique_resource_cold_reference()
+    {
+        struct Resource
+        {
+            ~Resource()
+            {
+                if (handle != -1)
+                {
+                    codegen_log(handle);
+                    codegen_log(handle + 1);
+                    codegen_close(handle);
+                }
+            }
+
+            int handle;
+        } resource{codegen_acquire()};
+        codegen_work_on(resource.handle);
+    }
+}